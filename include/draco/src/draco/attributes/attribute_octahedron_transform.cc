@@ -17,6 +17,8 @@
 
 #include "draco/attributes/attribute_transform_type.h"
 #include "draco/compression/attributes/normal_compression_utils.h"
+#include "draco/core/trace.h"
+#include "draco/core/vector_kernels.h"
 
 namespace draco {
 
@@ -47,6 +49,7 @@ bool AttributeOctahedronTransform::TransformAttribute(
 
 bool AttributeOctahedronTransform::InverseTransformAttribute(
     const PointAttribute &attribute, PointAttribute *target_attribute) {
+  DRACO_TRACE_ZONE("InverseTransform(Octahedron)");
   if (target_attribute->data_type() != DT_FLOAT32) {
     return false;
   }
@@ -56,25 +59,17 @@ bool AttributeOctahedronTransform::InverseTransformAttribute(
   if (num_components != 3) {
     return false;
   }
-  constexpr int kEntrySize = sizeof(float) * 3;
-  float att_val[3];
   const int32_t *source_attribute_data = reinterpret_cast<const int32_t *>(
       attribute.GetAddress(AttributeValueIndex(0)));
-  uint8_t *target_address =
-      target_attribute->GetAddress(AttributeValueIndex(0));
+  float *target_attribute_data = reinterpret_cast<float *>(
+      target_attribute->GetAddress(AttributeValueIndex(0)));
   OctahedronToolBox octahedron_tool_box;
   if (!octahedron_tool_box.SetQuantizationBits(quantization_bits_)) {
     return false;
   }
-  for (uint32_t i = 0; i < num_points; ++i) {
-    const int32_t s = *source_attribute_data++;
-    const int32_t t = *source_attribute_data++;
-    octahedron_tool_box.QuantizedOctahedralCoordsToUnitVector(s, t, att_val);
-
-    // Store the decoded floating point values into the attribute buffer.
-    std::memcpy(target_address, att_val, kEntrySize);
-    target_address += kEntrySize;
-  }
+  GetVectorKernels().octahedral_to_unit_vectors(
+      source_attribute_data, num_points,
+      octahedron_tool_box.dequantization_scale(), target_attribute_data);
   return true;
 }
 
@@ -14,9 +14,7 @@
 //
 #include "draco/attributes/point_attribute.h"
 
-#include <unordered_map>
-
-using std::unordered_map;
+#include "draco/core/flat_hash_map.h"
 
 // Shortcut for typed conditionals.
 template <bool B, class T, class F>
@@ -167,9 +165,10 @@ AttributeValueIndex::ValueType PointAttribute::DeduplicateFormattedValues(
   typedef std::array<T, num_components_t> AttributeValue;
   typedef std::array<HashType, num_components_t> AttributeHashableValue;
   // Hash map storing index of the first attribute with a given value.
-  unordered_map<AttributeHashableValue, AttributeValueIndex,
-                HashArray<AttributeHashableValue>>
+  FlatHashMap<AttributeHashableValue, AttributeValueIndex,
+              HashArray<AttributeHashableValue>>
       value_to_index_map;
+  value_to_index_map.reserve(num_unique_entries_);
   AttributeValue att_value;
   AttributeHashableValue hashable_value;
   IndexTypeVector<AttributeValueIndex, AttributeValueIndex> value_map(
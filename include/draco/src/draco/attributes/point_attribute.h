@@ -67,6 +67,13 @@ class PointAttribute : public GeometryAttribute {
     }
     return indices_map_.size();
   }
+  // Returns the value index of every point, or nullptr for identity mapping.
+  const AttributeValueIndex *indices_map_data() const {
+    if (is_mapping_identity()) {
+      return nullptr;
+    }
+    return indices_map_.data();
+  }
 
   const uint8_t *GetAddressOfMappedIndex(PointIndex point_index) const {
     return GetAddress(mapped_index(point_index));
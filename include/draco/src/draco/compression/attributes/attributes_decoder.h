@@ -20,6 +20,7 @@
 #include "draco/compression/attributes/attributes_decoder_interface.h"
 #include "draco/compression/point_cloud/point_cloud_decoder.h"
 #include "draco/core/decoder_buffer.h"
+#include "draco/core/trace.h"
 #include "draco/draco_features.h"
 #include "draco/point_cloud/point_cloud.h"
 
@@ -53,6 +54,7 @@ class AttributesDecoder : public AttributesDecoderInterface {
 
   // Decodes attribute data from the source buffer.
   bool DecodeAttributes(DecoderBuffer *in_buffer) override {
+    DRACO_TRACE_ZONE("DecodeAttributes");
     if (!DecodePortableAttributes(in_buffer)) {
       return false;
     }
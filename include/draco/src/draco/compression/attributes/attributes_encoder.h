@@ -48,9 +48,22 @@ class AttributesEncoder {
 
   // Encode attribute data to the target buffer.
   virtual bool EncodeAttributes(EncoderBuffer *out_buffer) {
-    if (!TransformAttributesToPortableFormat()) {
+    if (!PrepareAttributes()) {
       return false;
     }
+    return EncodePreparedAttributes(out_buffer);
+  }
+
+  // First step of EncodeAttributes() doing all the work other attribute
+  // encoders may depend on, i.e., transforming the attributes to the portable
+  // format. Once all attribute encoders are prepared (in the encoding order),
+  // their EncodePreparedAttributes() can be called concurrently.
+  virtual bool PrepareAttributes() {
+    return TransformAttributesToPortableFormat();
+  }
+
+  // Second step of EncodeAttributes() that encodes the prepared attributes.
+  bool EncodePreparedAttributes(EncoderBuffer *out_buffer) {
     if (!EncodePortableAttributes(out_buffer)) {
       return false;
     }
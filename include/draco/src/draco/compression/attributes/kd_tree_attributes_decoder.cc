@@ -511,8 +511,9 @@ bool KdTreeAttributesDecoder::TransformAttributesToOriginalFormat() {
 
       num_processed_quantized_attributes++;
 
-      if (GetDecoder()->options()->GetAttributeBool(
-              att->attribute_type(), "skip_attribute_transform", false)) {
+      if (GetDecoder()->resolved_options().GetAttributeBool(
+              att->attribute_type(),
+              ResolvedDecoderOptions::SKIP_ATTRIBUTE_TRANSFORM)) {
         // Attribute transform should not be performed. In this case, we replace
         // the output geometry attribute with the portable attribute.
         // TODO(ostava): We can potentially avoid this copy by introducing a new
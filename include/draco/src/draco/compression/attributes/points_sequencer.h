@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "draco/attributes/point_attribute.h"
+#include "draco/core/trace.h"
 
 namespace draco {
 
@@ -31,6 +32,7 @@ class PointsSequencer {
 
   // Fills the |out_point_ids| with the generated sequence of point ids.
   bool GenerateSequence(std::vector<PointIndex> *out_point_ids) {
+    DRACO_TRACE_ZONE("GenerateSequence");
     out_point_ids_ = out_point_ids;
     return GenerateSequenceInternal();
   }
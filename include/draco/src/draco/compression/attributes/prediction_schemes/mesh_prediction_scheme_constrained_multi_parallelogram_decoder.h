@@ -22,6 +22,7 @@
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_decoder.h"
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_parallelogram_shared.h"
 #include "draco/compression/bit_coders/rans_bit_decoder.h"
+#include "draco/core/trace.h"
 #include "draco/core/varint_decoding.h"
 #include "draco/draco_features.h"
 
@@ -83,6 +84,7 @@ bool MeshPredictionSchemeConstrainedMultiParallelogramDecoder<
     ComputeOriginalValues(const CorrType *in_corr, DataTypeT *out_data,
                           int /* size */, int num_components,
                           const PointIndex * /* entry_to_point_id_map */) {
+  DRACO_TRACE_ZONE("ComputeOriginalValues(ConstrainedMultiParallelogram)");
   this->transform().Init(num_components);
 
   // Predicted values for all simple parallelograms encountered at any given
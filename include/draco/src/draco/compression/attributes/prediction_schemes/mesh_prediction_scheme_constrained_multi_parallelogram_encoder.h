@@ -210,6 +210,16 @@ bool MeshPredictionSchemeConstrainedMultiParallelogramEncoder<
 
   std::vector<int> current_residuals(num_components);
 
+  // Variable for holding the best configuration that has been found so far.
+  // Reused for all vertices to avoid reallocating its buffers.
+  PredictionConfiguration best_prediction;
+
+  // Number of bits needed to store the crease edges of a vertex for each
+  // number of used parallelograms. It's the same for all configurations that
+  // use the same number of parallelograms so it's computed only once per
+  // vertex.
+  int64_t overhead_bits[kMaxNumParallelograms + 1];
+
   // We start processing the vertices from the end because this prediction uses
   // data from previous entries that could be overwritten when an entry is
   // processed.
@@ -261,9 +271,6 @@ bool MeshPredictionSchemeConstrainedMultiParallelogramEncoder<
     // Compute all prediction errors for all possible configurations of
     // available parallelograms.
 
-    // Variable for holding the best configuration that has been found so far.
-    PredictionConfiguration best_prediction;
-
     // Compute delta coding error (configuration when no parallelogram is
     // selected).
     const int src_offset = (p - 1) * num_components;
@@ -272,10 +279,12 @@ bool MeshPredictionSchemeConstrainedMultiParallelogramEncoder<
 
     if (num_parallelograms > 0) {
       total_parallelograms[num_parallelograms - 1] += num_parallelograms;
-      const int64_t new_overhead_bits =
-          ComputeOverheadBits(total_used_parallelograms[num_parallelograms - 1],
-                              total_parallelograms[num_parallelograms - 1]);
-      error.num_bits += new_overhead_bits;
+      for (int i = 0; i <= num_parallelograms; ++i) {
+        overhead_bits[i] = ComputeOverheadBits(
+            total_used_parallelograms[num_parallelograms - 1] + i,
+            total_parallelograms[num_parallelograms - 1]);
+      }
+      error.num_bits += overhead_bits[0];
     }
 
     best_prediction.error = error;
@@ -322,23 +331,16 @@ bool MeshPredictionSchemeConstrainedMultiParallelogramEncoder<
         }
         error = ComputeError(multi_pred_vals.data(), in_data + dst_offset,
                              &current_residuals[0], num_components);
-        if (num_parallelograms > 0) {
-          const int64_t new_overhead_bits = ComputeOverheadBits(
-              total_used_parallelograms[num_parallelograms - 1] +
-                  num_used_parallelograms,
-              total_parallelograms[num_parallelograms - 1]);
-
-          // Add overhead bits to the total error.
-          error.num_bits += new_overhead_bits;
-        }
+        // Add overhead bits to the total error.
+        error.num_bits += overhead_bits[num_used_parallelograms];
         if (error < best_prediction.error) {
           best_prediction.error = error;
           best_prediction.configuration = configuration;
           best_prediction.num_used_parallelograms = num_used_parallelograms;
-          best_prediction.predicted_value.assign(multi_pred_vals.begin(),
-                                                 multi_pred_vals.end());
-          best_prediction.residuals.assign(current_residuals.begin(),
-                                           current_residuals.end());
+          // Both temporary buffers are fully overwritten before their next
+          // use, so the best values can be swapped in instead of copied.
+          best_prediction.predicted_value.swap(multi_pred_vals);
+          best_prediction.residuals.swap(current_residuals);
         }
       } while (std::next_permutation(
           exluded_parallelograms, exluded_parallelograms + num_parallelograms));
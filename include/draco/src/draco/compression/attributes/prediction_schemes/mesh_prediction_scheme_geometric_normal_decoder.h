@@ -18,6 +18,7 @@
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_decoder.h"
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_geometric_normal_predictor_area.h"
 #include "draco/compression/bit_coders/rans_bit_decoder.h"
+#include "draco/core/trace.h"
 #include "draco/draco_features.h"
 
 namespace draco {
@@ -100,6 +101,7 @@ bool MeshPredictionSchemeGeometricNormalDecoder<
                                       DataTypeT *out_data, int /* size */,
                                       int num_components,
                                       const PointIndex *entry_to_point_id_map) {
+  DRACO_TRACE_ZONE("ComputeOriginalValues(GeometricNormal)");
   this->SetQuantizationBits(this->transform().quantization_bits());
   predictor_.SetEntryToPointIdMap(entry_to_point_id_map);
   DRACO_DCHECK(this->IsInitialized());
@@ -113,6 +115,9 @@ bool MeshPredictionSchemeGeometricNormalDecoder<
   VectorD<int32_t, 3> pred_normal_3d;
   int32_t pred_normal_oct[2];
 
+  // Neighbouring predictions share faces, compute each face normal only once.
+  predictor_.InitFaceNormalCache();
+
   for (int data_id = 0; data_id < corner_map_size; ++data_id) {
     const CornerIndex corner_id =
         this->mesh_data().data_to_corner_map()->at(data_id);
@@ -133,6 +138,7 @@ bool MeshPredictionSchemeGeometricNormalDecoder<
         pred_normal_oct, in_corr + data_offset, out_data + data_offset);
   }
   flip_normal_bit_decoder_.EndDecoding();
+  predictor_.ClearFaceNormalCache();
   return true;
 }
 
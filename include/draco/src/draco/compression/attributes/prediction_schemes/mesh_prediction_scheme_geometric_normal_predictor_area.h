@@ -15,6 +15,8 @@
 #ifndef DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_GEOMETRIC_NORMAL_PREDICTOR_AREA_H_
 #define DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_GEOMETRIC_NORMAL_PREDICTOR_AREA_H_
 
+#include <vector>
+
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_geometric_normal_predictor_base.h"
 
 namespace draco {
@@ -50,34 +52,49 @@ class MeshPredictionSchemeGeometricNormalPredictorArea
     // Computing normals for triangles and adding them up.
 
     VectorD<int64_t, 3> normal;
-    CornerIndex c_next, c_prev;
-    while (!cit.End()) {
-      // Getting corners.
-      if (this->normal_prediction_mode_ == ONE_TRIANGLE) {
-        c_next = corner_table->Next(corner_id);
-        c_prev = corner_table->Previous(corner_id);
-      } else {
-        c_next = corner_table->Next(cit.Corner());
-        c_prev = corner_table->Previous(cit.Corner());
+    if (this->normal_prediction_mode_ == TRIANGLE_AREA &&
+        !face_normal_computed_.empty()) {
+      // Same sum as below, but every face normal is only computed once.
+      while (!cit.End()) {
+        const VectorD<int64_t, 3> &cross =
+            GetCachedFaceNormal(corner_table->Face(cit.Corner()));
+        auto normal_data = reinterpret_cast<uint64_t *>(normal.data());
+        auto cross_data = reinterpret_cast<const uint64_t *>(cross.data());
+        normal_data[0] = normal_data[0] + cross_data[0];
+        normal_data[1] = normal_data[1] + cross_data[1];
+        normal_data[2] = normal_data[2] + cross_data[2];
+        cit.Next();
       }
-      const VectorD<int64_t, 3> pos_next = this->GetPositionForCorner(c_next);
-      const VectorD<int64_t, 3> pos_prev = this->GetPositionForCorner(c_prev);
+    } else {
+      CornerIndex c_next, c_prev;
+      while (!cit.End()) {
+        // Getting corners.
+        if (this->normal_prediction_mode_ == ONE_TRIANGLE) {
+          c_next = corner_table->Next(corner_id);
+          c_prev = corner_table->Previous(corner_id);
+        } else {
+          c_next = corner_table->Next(cit.Corner());
+          c_prev = corner_table->Previous(cit.Corner());
+        }
+        const VectorD<int64_t, 3> pos_next = this->GetPositionForCorner(c_next);
+        const VectorD<int64_t, 3> pos_prev = this->GetPositionForCorner(c_prev);
 
-      // Computing delta vectors to next and prev.
-      const VectorD<int64_t, 3> delta_next = pos_next - pos_cent;
-      const VectorD<int64_t, 3> delta_prev = pos_prev - pos_cent;
+        // Computing delta vectors to next and prev.
+        const VectorD<int64_t, 3> delta_next = pos_next - pos_cent;
+        const VectorD<int64_t, 3> delta_prev = pos_prev - pos_cent;
 
-      // Computing cross product.
-      const VectorD<int64_t, 3> cross = CrossProduct(delta_next, delta_prev);
+        // Computing cross product.
+        const VectorD<int64_t, 3> cross = CrossProduct(delta_next, delta_prev);
 
-      // Prevent signed integer overflows by doing math as unsigned.
-      auto normal_data = reinterpret_cast<uint64_t *>(normal.data());
-      auto cross_data = reinterpret_cast<const uint64_t *>(cross.data());
-      normal_data[0] = normal_data[0] + cross_data[0];
-      normal_data[1] = normal_data[1] + cross_data[1];
-      normal_data[2] = normal_data[2] + cross_data[2];
+        // Prevent signed integer overflows by doing math as unsigned.
+        auto normal_data = reinterpret_cast<uint64_t *>(normal.data());
+        auto cross_data = reinterpret_cast<const uint64_t *>(cross.data());
+        normal_data[0] = normal_data[0] + cross_data[0];
+        normal_data[1] = normal_data[1] + cross_data[1];
+        normal_data[2] = normal_data[2] + cross_data[2];
 
-      cit.Next();
+        cit.Next();
+      }
     }
 
     // Convert to int32_t, make sure entries are not too large.
@@ -100,6 +117,24 @@ class MeshPredictionSchemeGeometricNormalPredictorArea
     prediction[1] = static_cast<int32_t>(normal[1]);
     prediction[2] = static_cast<int32_t>(normal[2]);
   }
+
+  // Enables caching of the area weighted face normals used by
+  // ComputePredictedValue(). Every face is shared by the predictions of its
+  // three vertices, with the cache its cross product is computed only once.
+  // The predicted values stay bit-identical. Must be called once the position
+  // attribute and the entry to point id map are set.
+  void InitFaceNormalCache() {
+    const auto corner_table = this->mesh_data_.corner_table();
+    face_normals_.resize(corner_table->num_faces());
+    face_normal_computed_.assign(corner_table->num_faces(), 0);
+  }
+  void ClearFaceNormalCache() {
+    face_normals_.clear();
+    face_normals_.shrink_to_fit();
+    face_normal_computed_.clear();
+    face_normal_computed_.shrink_to_fit();
+  }
+
   bool SetNormalPredictionMode(NormalPredictionMode mode) override {
     if (mode == ONE_TRIANGLE) {
       this->normal_prediction_mode_ = mode;
@@ -110,6 +145,27 @@ class MeshPredictionSchemeGeometricNormalPredictorArea
     }
     return false;
   }
+
+ private:
+  // Returns the cross product of the face edges, which is the same for all
+  // three corners of the face (the area weighted normal of the face).
+  const VectorD<int64_t, 3> &GetCachedFaceNormal(FaceIndex face) {
+    if (!face_normal_computed_[face.value()]) {
+      const auto corner_table = this->mesh_data_.corner_table();
+      const CornerIndex c = corner_table->FirstCorner(face);
+      const VectorD<int64_t, 3> pos_cent = this->GetPositionForCorner(c);
+      const VectorD<int64_t, 3> delta_next =
+          this->GetPositionForCorner(corner_table->Next(c)) - pos_cent;
+      const VectorD<int64_t, 3> delta_prev =
+          this->GetPositionForCorner(corner_table->Previous(c)) - pos_cent;
+      face_normals_[face.value()] = CrossProduct(delta_next, delta_prev);
+      face_normal_computed_[face.value()] = 1;
+    }
+    return face_normals_[face.value()];
+  }
+
+  std::vector<VectorD<int64_t, 3>> face_normals_;
+  std::vector<uint8_t> face_normal_computed_;
 };
 
 }  // namespace draco
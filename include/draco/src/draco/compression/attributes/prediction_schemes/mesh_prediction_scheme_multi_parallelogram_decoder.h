@@ -18,6 +18,7 @@
 
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_decoder.h"
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_parallelogram_shared.h"
+#include "draco/core/trace.h"
 #include "draco/draco_features.h"
 
 namespace draco {
@@ -60,6 +61,7 @@ bool MeshPredictionSchemeMultiParallelogramDecoder<DataTypeT, TransformT,
     ComputeOriginalValues(const CorrType *in_corr, DataTypeT *out_data,
                           int /* size */, int num_components,
                           const PointIndex * /* entry_to_point_id_map */) {
+  DRACO_TRACE_ZONE("ComputeOriginalValues(MultiParallelogram)");
   this->transform().Init(num_components);
 
   // For storage of prediction values (already initialized to zero).
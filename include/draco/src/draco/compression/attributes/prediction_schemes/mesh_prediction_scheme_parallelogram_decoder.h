@@ -17,6 +17,7 @@
 
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_decoder.h"
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_parallelogram_shared.h"
+#include "draco/core/trace.h"
 
 namespace draco {
 
@@ -58,6 +59,7 @@ bool MeshPredictionSchemeParallelogramDecoder<DataTypeT, TransformT,
     ComputeOriginalValues(const CorrType *in_corr, DataTypeT *out_data,
                           int /* size */, int num_components,
                           const PointIndex * /* entry_to_point_id_map */) {
+  DRACO_TRACE_ZONE("ComputeOriginalValues(Parallelogram)");
   this->transform().Init(num_components);
 
   const CornerTable *const table = this->mesh_data().corner_table();
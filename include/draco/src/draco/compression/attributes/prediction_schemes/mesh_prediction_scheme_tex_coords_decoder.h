@@ -20,6 +20,7 @@
 
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_decoder.h"
 #include "draco/compression/bit_coders/rans_bit_decoder.h"
+#include "draco/core/trace.h"
 #include "draco/core/varint_decoding.h"
 #include "draco/core/vector_d.h"
 #include "draco/draco_features.h"
@@ -123,6 +124,7 @@ bool MeshPredictionSchemeTexCoordsDecoder<DataTypeT, TransformT, MeshDataT>::
     ComputeOriginalValues(const CorrType *in_corr, DataTypeT *out_data,
                           int /* size */, int num_components,
                           const PointIndex *entry_to_point_id_map) {
+  DRACO_TRACE_ZONE("ComputeOriginalValues(TexCoords)");
   num_components_ = num_components;
   entry_to_point_id_map_ = entry_to_point_id_map;
   predicted_value_ =
@@ -18,6 +18,7 @@
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_decoder.h"
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_tex_coords_portable_predictor.h"
 #include "draco/compression/bit_coders/rans_bit_decoder.h"
+#include "draco/core/trace.h"
 
 namespace draco {
 
@@ -88,6 +89,7 @@ bool MeshPredictionSchemeTexCoordsPortableDecoder<
                                       DataTypeT *out_data, int /* size */,
                                       int num_components,
                                       const PointIndex *entry_to_point_id_map) {
+  DRACO_TRACE_ZONE("ComputeOriginalValues(TexCoordsPortable)");
   if (num_components != MeshPredictionSchemeTexCoordsPortablePredictor<
                             DataTypeT, MeshDataT>::kNumComponents) {
     return false;
@@ -16,6 +16,7 @@
 #define DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_PREDICTION_SCHEME_DELTA_DECODER_H_
 
 #include "draco/compression/attributes/prediction_schemes/prediction_scheme_decoder.h"
+#include "draco/core/trace.h"
 
 namespace draco {
 
@@ -47,6 +48,7 @@ template <typename DataTypeT, class TransformT>
 bool PredictionSchemeDeltaDecoder<DataTypeT, TransformT>::ComputeOriginalValues(
     const CorrType *in_corr, DataTypeT *out_data, int size, int num_components,
     const PointIndex *) {
+  DRACO_TRACE_ZONE("ComputeOriginalValues(Delta)");
   this->transform().Init(num_components);
   // Decode the original value for the first element.
   std::unique_ptr<DataTypeT[]> zero_vals(new DataTypeT[num_components]());
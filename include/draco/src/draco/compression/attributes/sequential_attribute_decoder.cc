@@ -36,8 +36,13 @@ bool SequentialAttributeDecoder::InitializeStandalone(
 
 bool SequentialAttributeDecoder::DecodePortableAttribute(
     const std::vector<PointIndex> &point_ids, DecoderBuffer *in_buffer) {
-  if (attribute_->num_components() <= 0 ||
-      !attribute_->Reset(point_ids.size())) {
+  if (attribute_->num_components() <= 0) {
+    return false;
+  }
+  if (ShouldSkipValues()) {
+    return SkipValues(point_ids, in_buffer);
+  }
+  if (!attribute_->Reset(point_ids.size())) {
     return false;
   }
   if (!DecodeValues(point_ids, in_buffer)) {
@@ -72,6 +77,20 @@ const PointAttribute *SequentialAttributeDecoder::GetPortableAttribute() {
   return portable_attribute_.get();
 }
 
+bool SequentialAttributeDecoder::ShouldSkipValues() const {
+  if (decoder_ == nullptr || decoder_->options() == nullptr) {
+    return false;
+  }
+#ifdef DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED
+  // Older files interleave the values with the transform data, decode them
+  // fully and only drop the attribute afterwards.
+  if (decoder_->bitstream_version() < DRACO_BITSTREAM_VERSION(2, 0)) {
+    return false;
+  }
+#endif
+  return !decoder_->resolved_options().IsAttributeDecoded(*attribute_);
+}
+
 bool SequentialAttributeDecoder::InitPredictionScheme(
     PredictionSchemeInterface *ps) {
   for (int i = 0; i < ps->GetNumParentAttributes(); ++i) {
@@ -115,4 +134,15 @@ bool SequentialAttributeDecoder::DecodeValues(
   return true;
 }
 
+bool SequentialAttributeDecoder::SkipValues(
+    const std::vector<PointIndex> &point_ids, DecoderBuffer *in_buffer) {
+  const int64_t num_bytes = static_cast<int64_t>(point_ids.size()) *
+                            static_cast<int64_t>(attribute_->byte_stride());
+  if (in_buffer->remaining_size() < num_bytes) {
+    return false;
+  }
+  in_buffer->Advance(num_bytes);
+  return true;
+}
+
 }  // namespace draco
@@ -50,6 +50,11 @@ class SequentialAttributeDecoder {
 
   const PointAttribute *GetPortableAttribute();
 
+  // Returns true when the values of the attribute were not requested by the
+  // decoder options and are only skipped in the input buffer. Such attributes
+  // are removed from the geometry once the decoding is finished.
+  bool ShouldSkipValues() const;
+
   const PointAttribute *attribute() const { return attribute_; }
   PointAttribute *attribute() { return attribute_; }
   int attribute_id() const { return attribute_id_; }
@@ -66,6 +71,10 @@ class SequentialAttributeDecoder {
   virtual bool DecodeValues(const std::vector<PointIndex> &point_ids,
                             DecoderBuffer *in_buffer);
 
+  // Moves |in_buffer| past the data that would be decoded by DecodeValues().
+  virtual bool SkipValues(const std::vector<PointIndex> &point_ids,
+                          DecoderBuffer *in_buffer);
+
   void SetPortableAttribute(std::unique_ptr<PointAttribute> att) {
     portable_attribute_ = std::move(att);
   }
@@ -95,6 +95,9 @@ bool SequentialAttributeDecodersController::
     TransformAttributesToOriginalFormat() {
   const int32_t num_attributes = GetNumAttributes();
   for (int i = 0; i < num_attributes; ++i) {
+    if (sequential_decoders_[i]->ShouldSkipValues()) {
+      continue;  // Nothing was decoded for the attribute.
+    }
     // Check whether the attribute transform should be skipped.
     if (GetDecoder()->options()) {
       const PointAttribute *const attribute =
@@ -102,8 +105,9 @@ bool SequentialAttributeDecodersController::
       const PointAttribute *const portable_attribute =
           sequential_decoders_[i]->GetPortableAttribute();
       if (portable_attribute &&
-          GetDecoder()->options()->GetAttributeBool(
-              attribute->attribute_type(), "skip_attribute_transform", false)) {
+          GetDecoder()->resolved_options().GetAttributeBool(
+              attribute->attribute_type(),
+              ResolvedDecoderOptions::SKIP_ATTRIBUTE_TRANSFORM)) {
         // Attribute transform should not be performed. In this case, we replace
         // the output geometry attribute with the portable attribute.
         // TODO(ostava): We can potentially avoid this copy by introducing a new
@@ -18,6 +18,7 @@
 #endif
 #include "draco/compression/attributes/sequential_quantization_attribute_encoder.h"
 #include "draco/compression/point_cloud/point_cloud_encoder.h"
+#include "draco/core/parallel_tasks.h"
 
 namespace draco {
 
@@ -59,12 +60,11 @@ bool SequentialAttributeEncodersController::EncodeAttributesEncoderData(
   return true;
 }
 
-bool SequentialAttributeEncodersController::EncodeAttributes(
-    EncoderBuffer *buffer) {
+bool SequentialAttributeEncodersController::PrepareAttributes() {
   if (!sequencer_ || !sequencer_->GenerateSequence(&point_ids_)) {
     return false;
   }
-  return AttributesEncoder::EncodeAttributes(buffer);
+  return AttributesEncoder::PrepareAttributes();
 }
 
 bool SequentialAttributeEncodersController::
@@ -80,11 +80,33 @@ bool SequentialAttributeEncodersController::
 
 bool SequentialAttributeEncodersController::EncodePortableAttributes(
     EncoderBuffer *out_buffer) {
-  for (uint32_t i = 0; i < sequential_encoders_.size(); ++i) {
-    if (!sequential_encoders_[i]->EncodePortableAttribute(point_ids_,
-                                                          out_buffer)) {
-      return false;
+  // When the point cloud encoder has several attribute encoders it runs them
+  // in parallel already, otherwise the attributes of this encoder are encoded
+  // in parallel. All portable attributes exist at this point, so the encoders
+  // only read shared data.
+  const int num_threads =
+      encoder()->num_attributes_encoders() == 1
+          ? encoder()->options()->GetGlobalInt("num_encoding_threads", 1)
+          : 1;
+  const int num_encoders = static_cast<int>(sequential_encoders_.size());
+  if (num_threads <= 1 || num_encoders <= 1) {
+    for (int i = 0; i < num_encoders; ++i) {
+      if (!sequential_encoders_[i]->EncodePortableAttribute(point_ids_,
+                                                            out_buffer)) {
+        return false;
+      }
     }
+    return true;
+  }
+  std::vector<EncoderBuffer> buffers(num_encoders);
+  if (!RunParallelTasks(num_encoders, num_threads, [&](int i) {
+        return sequential_encoders_[i]->EncodePortableAttribute(point_ids_,
+                                                                &buffers[i]);
+      })) {
+    return false;
+  }
+  for (const EncoderBuffer &buffer : buffers) {
+    out_buffer->Encode(buffer.data(), buffer.size());
   }
   return true;
 }
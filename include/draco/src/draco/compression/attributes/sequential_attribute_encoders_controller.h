@@ -37,7 +37,7 @@ class SequentialAttributeEncodersController : public AttributesEncoder {
 
   bool Init(PointCloudEncoder *encoder, const PointCloud *pc) override;
   bool EncodeAttributesEncoderData(EncoderBuffer *out_buffer) override;
-  bool EncodeAttributes(EncoderBuffer *buffer) override;
+  bool PrepareAttributes() override;
   uint8_t GetUniqueId() const override { return BASIC_ATTRIBUTE_ENCODER; }
 
   int NumParentAttributes(int32_t point_attribute_id) const override {
@@ -17,6 +17,7 @@
 #include "draco/compression/attributes/prediction_schemes/prediction_scheme_decoder_factory.h"
 #include "draco/compression/attributes/prediction_schemes/prediction_scheme_wrap_decoding_transform.h"
 #include "draco/compression/entropy/symbol_decoding.h"
+#include "draco/core/trace.h"
 
 namespace draco {
 
@@ -41,8 +42,8 @@ bool SequentialIntegerAttributeDecoder::TransformAttributeToOriginalFormat(
   return StoreValues(static_cast<uint32_t>(point_ids.size()));
 }
 
-bool SequentialIntegerAttributeDecoder::DecodeValues(
-    const std::vector<PointIndex> &point_ids, DecoderBuffer *in_buffer) {
+bool SequentialIntegerAttributeDecoder::DecodePredictionScheme(
+    DecoderBuffer *in_buffer) {
   // Decode prediction scheme.
   int8_t prediction_scheme_method;
   if (!in_buffer->Decode(&prediction_scheme_method)) {
@@ -68,7 +69,14 @@ bool SequentialIntegerAttributeDecoder::DecodeValues(
       return false;
     }
   }
+  return true;
+}
 
+bool SequentialIntegerAttributeDecoder::DecodeValues(
+    const std::vector<PointIndex> &point_ids, DecoderBuffer *in_buffer) {
+  if (!DecodePredictionScheme(in_buffer)) {
+    return false;
+  }
   if (!DecodeIntegerValues(point_ids, in_buffer)) {
     return false;
   }
@@ -86,6 +94,48 @@ bool SequentialIntegerAttributeDecoder::DecodeValues(
   return true;
 }
 
+bool SequentialIntegerAttributeDecoder::SkipValues(
+    const std::vector<PointIndex> &point_ids, DecoderBuffer *in_buffer) {
+  if (!DecodePredictionScheme(in_buffer)) {
+    return false;
+  }
+  const int num_components = GetNumValueComponents();
+  if (num_components <= 0) {
+    return false;
+  }
+  const size_t num_values = point_ids.size() * num_components;
+  // The portable attribute holds only the parameters of the portable
+  // transform that are decoded later.
+  PreparePortableAttribute(0, num_components);
+  uint8_t compressed;
+  if (!in_buffer->Decode(&compressed)) {
+    return false;
+  }
+  if (compressed > 0) {
+    if (!SkipSymbols(static_cast<uint32_t>(num_values), num_components,
+                     in_buffer)) {
+      return false;
+    }
+  } else {
+    uint8_t num_bytes;
+    if (!in_buffer->Decode(&num_bytes)) {
+      return false;
+    }
+    const int64_t data_size =
+        static_cast<int64_t>(num_bytes) * static_cast<int64_t>(num_values);
+    if (in_buffer->remaining_size() < data_size) {
+      return false;
+    }
+    in_buffer->Advance(data_size);
+  }
+  // The prediction data follows the values and must be consumed as well.
+  if (prediction_scheme_ &&
+      !prediction_scheme_->DecodePredictionData(in_buffer)) {
+    return false;
+  }
+  return true;
+}
+
 std::unique_ptr<PredictionSchemeTypedDecoderInterface<int32_t>>
 SequentialIntegerAttributeDecoder::CreateIntPredictionScheme(
     PredictionSchemeMethod method,
@@ -100,6 +150,7 @@ SequentialIntegerAttributeDecoder::CreateIntPredictionScheme(
 
 bool SequentialIntegerAttributeDecoder::DecodeIntegerValues(
     const std::vector<PointIndex> &point_ids, DecoderBuffer *in_buffer) {
+  DRACO_TRACE_ZONE("DecodeIntegerValues");
   const int num_components = GetNumValueComponents();
   if (num_components <= 0) {
     return false;
@@ -35,6 +35,8 @@ class SequentialIntegerAttributeDecoder : public SequentialAttributeDecoder {
                     DecoderBuffer *in_buffer) override;
   virtual bool DecodeIntegerValues(const std::vector<PointIndex> &point_ids,
                                    DecoderBuffer *in_buffer);
+  bool SkipValues(const std::vector<PointIndex> &point_ids,
+                  DecoderBuffer *in_buffer) override;
 
   // Returns a prediction scheme that should be used for decoding of the
   // integer values.
@@ -63,6 +65,10 @@ class SequentialIntegerAttributeDecoder : public SequentialAttributeDecoder {
   }
 
  private:
+  // Decodes the prediction method and creates and initializes the prediction
+  // scheme used by the attribute, if any.
+  bool DecodePredictionScheme(DecoderBuffer *in_buffer);
+
   // Stores decoded values into the attribute with a data type AttributeTypeT.
   template <typename AttributeTypeT>
   void StoreTypedValues(uint32_t num_values);
@@ -15,8 +15,11 @@
 #ifndef DRACO_COMPRESSION_CONFIG_DECODER_OPTIONS_H_
 #define DRACO_COMPRESSION_CONFIG_DECODER_OPTIONS_H_
 
+#include <algorithm>
+#include <array>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "draco/attributes/geometry_attribute.h"
 #include "draco/compression/config/draco_options.h"
@@ -27,7 +30,114 @@ namespace draco {
 // decoding of the input geometry. The options can be specified either for the
 // whole geometry or for a specific attribute type. Each option is identified
 // by a unique name stored as an std::string.
-typedef DracoOptions<GeometryAttribute::Type> DecoderOptions;
+class DecoderOptions : public DracoOptions<GeometryAttribute::Type> {
+ public:
+  DecoderOptions() : decode_all_attributes_(true) {}
+
+  // Restricts decoding to the attributes with the given unique ids. See
+  // Decoder::SetAttributesToDecode().
+  void SetDecodedAttributeIds(const std::vector<uint32_t> &unique_ids) {
+    decoded_attribute_ids_ = unique_ids;
+    std::sort(decoded_attribute_ids_.begin(), decoded_attribute_ids_.end());
+    decode_all_attributes_ = false;
+  }
+  // Decodes all attributes again, which is the default.
+  void ClearDecodedAttributeIds() {
+    decoded_attribute_ids_.clear();
+    decode_all_attributes_ = true;
+  }
+
+  bool decode_all_attributes() const { return decode_all_attributes_; }
+  // Sorted unique ids of the attributes to decode. Only used when
+  // decode_all_attributes() is false.
+  const std::vector<uint32_t> &decoded_attribute_ids() const {
+    return decoded_attribute_ids_;
+  }
+
+ private:
+  bool decode_all_attributes_;
+  std::vector<uint32_t> decoded_attribute_ids_;
+};
+
+// Typed copy of the DecoderOptions queried while decoding. The options are
+// resolved once per decoded geometry so that the decoders don't need to look
+// up (and parse) the string keyed options for every attribute. DecoderOptions
+// remains the public interface for setting the options.
+class ResolvedDecoderOptions {
+ public:
+  // Boolean options that can be set per attribute type.
+  enum AttributeBoolOption {
+    SKIP_ATTRIBUTE_TRANSFORM = 0,
+    NUM_ATTRIBUTE_BOOL_OPTIONS
+  };
+
+  ResolvedDecoderOptions()
+      : attribute_bools_(), decode_all_attributes_(true) {}
+
+  void Resolve(const DecoderOptions &options) {
+    static const char *const kAttributeBoolOptionNames[] = {
+        "skip_attribute_transform"};
+    // Attribute options fall back to the global options, which are looked up
+    // once. Usually no attribute options are set and nothing else is needed.
+    for (int o = 0; o < NUM_ATTRIBUTE_BOOL_OPTIONS; ++o) {
+      const bool value =
+          options.GetGlobalBool(kAttributeBoolOptionNames[o], false);
+      for (int t = 0; t < GeometryAttribute::NAMED_ATTRIBUTES_COUNT; ++t) {
+        attribute_bools_[t][o] = value;
+      }
+    }
+    if (options.HasAttributeOptions()) {
+      for (int t = 0; t < GeometryAttribute::NAMED_ATTRIBUTES_COUNT; ++t) {
+        const Options *const attribute_options = options.FindAttributeOptions(
+            static_cast<GeometryAttribute::Type>(t));
+        if (attribute_options == nullptr) {
+          continue;
+        }
+        for (int o = 0; o < NUM_ATTRIBUTE_BOOL_OPTIONS; ++o) {
+          if (attribute_options->IsOptionSet(kAttributeBoolOptionNames[o])) {
+            attribute_bools_[t][o] = attribute_options->GetBool(
+                kAttributeBoolOptionNames[o], false);
+          }
+        }
+      }
+    }
+    decode_all_attributes_ = options.decode_all_attributes();
+    if (decode_all_attributes_) {
+      decoded_attribute_ids_.clear();
+    } else {
+      decoded_attribute_ids_ = options.decoded_attribute_ids();
+    }
+  }
+
+  bool GetAttributeBool(GeometryAttribute::Type type,
+                        AttributeBoolOption option) const {
+    if (type < 0 || type >= GeometryAttribute::NAMED_ATTRIBUTES_COUNT) {
+      return false;
+    }
+    return attribute_bools_[type][option];
+  }
+
+  // Returns false when the values of |attribute| were not requested and the
+  // attribute is going to be removed from the decoded geometry. Positions are
+  // always decoded because other attributes may be predicted from them.
+  bool IsAttributeDecoded(const GeometryAttribute &attribute) const {
+    if (decode_all_attributes_ ||
+        attribute.attribute_type() == GeometryAttribute::POSITION) {
+      return true;
+    }
+    return std::binary_search(decoded_attribute_ids_.begin(),
+                              decoded_attribute_ids_.end(),
+                              attribute.unique_id());
+  }
+  bool decode_all_attributes() const { return decode_all_attributes_; }
+
+ private:
+  std::array<std::array<bool, NUM_ATTRIBUTE_BOOL_OPTIONS>,
+             GeometryAttribute::NAMED_ATTRIBUTES_COUNT>
+      attribute_bools_;
+  bool decode_all_attributes_;
+  std::vector<uint32_t> decoded_attribute_ids_;
+};
 
 }  // namespace draco
 
@@ -101,6 +101,13 @@ class DracoOptions {
   void SetGlobalBool(const std::string &name, bool val) {
     global_options_.SetBool(name, val);
   }
+  std::string GetGlobalString(const std::string &name,
+                              const std::string &default_val) const {
+    return global_options_.GetString(name, default_val);
+  }
+  void SetGlobalString(const std::string &name, const std::string &val) {
+    global_options_.SetString(name, val);
+  }
   template <typename DataTypeT>
   bool GetGlobalVector(const std::string &name, int num_dims,
                        DataTypeT *val) const {
@@ -121,6 +128,8 @@ class DracoOptions {
 
   // Returns |Options| instance for the specified options class if it exists.
   const Options *FindAttributeOptions(const AttributeKeyT &att_key) const;
+  // Returns true when an option was set for any attribute key.
+  bool HasAttributeOptions() const { return !attribute_options_.empty(); }
   const Options &GetGlobalOptions() const { return global_options_; }
 
  private:
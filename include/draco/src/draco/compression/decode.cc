@@ -132,4 +132,8 @@ void Decoder::SetSkipAttributeTransform(GeometryAttribute::Type att_type) {
   options_.SetAttributeBool(att_type, "skip_attribute_transform", true);
 }
 
+void Decoder::SetAttributesToDecode(const std::vector<uint32_t> &unique_ids) {
+  options_.SetDecodedAttributeIds(unique_ids);
+}
+
 }  // namespace draco
@@ -15,6 +15,8 @@
 #ifndef DRACO_COMPRESSION_DECODE_H_
 #define DRACO_COMPRESSION_DECODE_H_
 
+#include <vector>
+
 #include "draco/compression/config/compression_shared.h"
 #include "draco/compression/config/decoder_options.h"
 #include "draco/core/decoder_buffer.h"
@@ -67,6 +69,13 @@ class Decoder {
   // transform manually.
   void SetSkipAttributeTransform(GeometryAttribute::Type att_type);
 
+  // Restricts decoding to the attributes with the given unique ids. Other
+  // attributes are skipped in the input buffer whenever the encoding method
+  // allows it and they are not present in the decoded geometry. Positions are
+  // always decoded, so passing an empty list decodes only the positions (and
+  // the connectivity of meshes).
+  void SetAttributesToDecode(const std::vector<uint32_t> &unique_ids);
+
   // Returns the options instance used by the decoder that can be used by users
   // to control the decoding process.
   DecoderOptions *options() { return &options_; }
@@ -43,6 +43,12 @@ class EncoderBase {
   // Note that this can slow down encoding for certain encoders.
   void SetTrackEncodedProperties(bool flag);
 
+  // Sets the maximum number of threads used to encode independent attributes
+  // (default = 1). The encoded data is the same for any number of threads.
+  void SetNumEncodingThreads(int num_threads) {
+    options_.SetGlobalInt("num_encoding_threads", num_threads);
+  }
+
   // Returns the number of encoded points and faces during the last encoding
   // operation. Returns 0 if SetTrackEncodedProperties() was not set.
   size_t num_encoded_points() const { return num_encoded_points_; }
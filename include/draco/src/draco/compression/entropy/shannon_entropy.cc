@@ -71,6 +71,8 @@ ShannonEntropyTracker::EntropyData ShannonEntropyTracker::UpdateSymbols(
     const uint32_t symbol = symbols[i];
     if (frequencies_.size() <= symbol) {
       frequencies_.resize(symbol + 1, 0);
+      symbol_entropy_norms_.resize(symbol + 1, 0.0);
+      next_symbol_entropy_norms_.resize(symbol + 1, 0.0);
     }
 
     // Update the entropy of the stream. Note that entropy of |N| values
@@ -91,10 +93,21 @@ ShannonEntropyTracker::EntropyData ShannonEntropyTracker::UpdateSymbols(
     //
     //  entropy = log2(N) - entropy_norm / N
     //
+    // The cached norms are valid unless the symbol was already updated by an
+    // earlier entry of |symbols|.
+    bool use_cached_norms = true;
+    for (int j = 0; j < i; ++j) {
+      if (symbols[j] == symbol) {
+        use_cached_norms = false;
+        break;
+      }
+    }
     double old_symbol_entropy_norm = 0;
     int &frequency = frequencies_[symbol];
     if (frequency > 1) {
-      old_symbol_entropy_norm = frequency * std::log2(frequency);
+      old_symbol_entropy_norm = use_cached_norms
+                                    ? symbol_entropy_norms_[symbol]
+                                    : frequency * std::log2(frequency);
     } else if (frequency == 0) {
       ret_data.num_unique_symbols++;
       if (symbol > static_cast<uint32_t>(ret_data.max_symbol)) {
@@ -102,7 +115,9 @@ ShannonEntropyTracker::EntropyData ShannonEntropyTracker::UpdateSymbols(
       }
     }
     frequency++;
-    const double new_symbol_entropy_norm = frequency * std::log2(frequency);
+    const double new_symbol_entropy_norm =
+        use_cached_norms ? next_symbol_entropy_norms_[symbol]
+                         : frequency * std::log2(frequency);
 
     // Update the final entropy.
     ret_data.entropy_norm += new_symbol_entropy_norm - old_symbol_entropy_norm;
@@ -110,6 +125,14 @@ ShannonEntropyTracker::EntropyData ShannonEntropyTracker::UpdateSymbols(
   if (push_changes) {
     // Update entropy data of the stream.
     entropy_data_ = ret_data;
+    for (int i = 0; i < num_symbols; ++i) {
+      const uint32_t symbol = symbols[i];
+      const int frequency = frequencies_[symbol];
+      const int next_frequency = frequency + 1;
+      symbol_entropy_norms_[symbol] = frequency * std::log2(frequency);
+      next_symbol_entropy_norms_[symbol] =
+          next_frequency * std::log2(next_frequency);
+    }
   } else {
     // We are only peeking so do not update the stream.
     // Revert changes in the frequency table.
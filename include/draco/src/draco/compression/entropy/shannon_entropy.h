@@ -101,6 +101,11 @@ class ShannonEntropyTracker {
                             bool push_changes);
 
   std::vector<int32_t> frequencies_;
+  // Entropy norms (frequency * log2(frequency)) of every symbol for its current
+  // frequency and for the frequency incremented by one. Caching them avoids
+  // evaluating log2() for every peeked symbol.
+  std::vector<double> symbol_entropy_norms_;
+  std::vector<double> next_symbol_entropy_norms_;
 
   EntropyData entropy_data_;
 };
@@ -18,6 +18,7 @@
 #include <cmath>
 
 #include "draco/compression/entropy/rans_symbol_decoder.h"
+#include "draco/core/varint_decoding.h"
 
 namespace draco {
 
@@ -49,6 +50,93 @@ bool DecodeSymbols(uint32_t num_values, int num_components,
   return false;
 }
 
+namespace {
+
+// Moves |src_buffer| past a probability table and the data encoded by a
+// RAnsSymbolEncoder without building the decoding tables.
+bool SkipRAnsSymbols(DecoderBuffer *src_buffer) {
+  uint32_t num_symbols;
+  if (!DecodeVarint(&num_symbols, src_buffer) || num_symbols == 0) {
+    return false;
+  }
+  for (uint32_t i = 0; i < num_symbols; ++i) {
+    uint8_t prob_data;
+    if (!src_buffer->Decode(&prob_data)) {
+      return false;
+    }
+    const int token = prob_data & 3;
+    if (token == 3) {
+      // Run of symbols with zero probability.
+      i += prob_data >> 2;
+    } else {
+      // The token is the number of extra bytes of the probability.
+      if (src_buffer->remaining_size() < token) {
+        return false;
+      }
+      src_buffer->Advance(token);
+    }
+  }
+  uint64_t bytes_encoded;
+  if (!DecodeVarint<uint64_t>(&bytes_encoded, src_buffer)) {
+    return false;
+  }
+  if (bytes_encoded > static_cast<uint64_t>(src_buffer->remaining_size())) {
+    return false;
+  }
+  src_buffer->Advance(bytes_encoded);
+  return true;
+}
+
+}  // namespace
+
+bool SkipSymbols(uint32_t num_values, int num_components,
+                 DecoderBuffer *src_buffer) {
+  if (num_values == 0) {
+    return true;
+  }
+#ifdef DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED
+  if (src_buffer->bitstream_version() < DRACO_BITSTREAM_VERSION(2, 0)) {
+    return false;
+  }
+#endif
+  uint8_t scheme;
+  if (!src_buffer->Decode(&scheme)) {
+    return false;
+  }
+  if (scheme == SYMBOL_CODING_RAW) {
+    uint8_t max_bit_length;
+    if (!src_buffer->Decode(&max_bit_length)) {
+      return false;
+    }
+    return SkipRAnsSymbols(src_buffer);
+  }
+  if (scheme != SYMBOL_CODING_TAGGED) {
+    return false;
+  }
+  // The size of the raw bits following the tags is not stored so the tags
+  // need to be decoded to find the end of the data.
+  RAnsSymbolDecoder<5> tag_decoder;
+  if (!tag_decoder.Create(src_buffer) ||
+      !tag_decoder.StartDecoding(src_buffer)) {
+    return false;
+  }
+  if (tag_decoder.num_symbols() == 0) {
+    return false;
+  }
+  uint64_t num_bits = 0;
+  for (uint32_t i = 0; i < num_values; i += num_components) {
+    num_bits += static_cast<uint64_t>(tag_decoder.DecodeSymbol()) *
+                num_components;
+  }
+  tag_decoder.EndDecoding();
+  const uint64_t num_bytes = (num_bits + 7) / 8;
+  if (num_bytes > static_cast<uint64_t>(src_buffer->remaining_size())) {
+    return false;
+  }
+  src_buffer->Advance(num_bytes);
+  return true;
+}
+
 template <template <int> class SymbolDecoderT>
 bool DecodeTaggedSymbols(uint32_t num_values, int num_components,
                          DecoderBuffer *src_buffer, uint32_t *out_values) {
@@ -24,6 +24,12 @@ namespace draco {
 bool DecodeSymbols(uint32_t num_values, int num_components,
                    DecoderBuffer *src_buffer, uint32_t *out_values);
 
+// Moves |src_buffer| past the symbols encoded for |num_values| values without
+// storing them. Only bitstreams of version 2.0 and newer are supported.
+// Returns false on error.
+bool SkipSymbols(uint32_t num_values, int num_components,
+                 DecoderBuffer *src_buffer);
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_ENTROPY_SYMBOL_DECODING_H_
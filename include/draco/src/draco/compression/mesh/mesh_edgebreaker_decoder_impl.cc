@@ -25,6 +25,7 @@
 #include "draco/compression/mesh/traverser/mesh_attribute_indices_encoding_observer.h"
 #include "draco/compression/mesh/traverser/mesh_traversal_sequencer.h"
 #include "draco/compression/mesh/traverser/traverser_base.h"
+#include "draco/core/trace.h"
 #include "draco/mesh/corner_table_iterators.h"
 
 namespace draco {
@@ -244,6 +245,7 @@ bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::CreateAttributesDecoder(
 
 template <class TraversalDecoder>
 bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity() {
+  DRACO_TRACE_ZONE("DecodeConnectivity");
   num_new_vertices_ = 0;
   new_to_parent_vertex_map_.clear();
 #ifdef DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED
@@ -455,6 +457,7 @@ bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity() {
 
   // Decode connectivity of non-position attributes.
   if (!attribute_data_.empty()) {
+    DRACO_TRACE_ZONE("DecodeAttributeSeams");
 #ifdef DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED
     if (decoder_->bitstream_version() < DRACO_BITSTREAM_VERSION(2, 1)) {
       for (CornerIndex ci(0); ci < corner_table_->num_corners(); ci += 3) {
@@ -514,6 +517,7 @@ bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::OnAttributesDecoded() {
 template <class TraversalDecoder>
 int MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity(
     int num_symbols) {
+  DRACO_TRACE_ZONE("DecodeTraversal");
   // Algorithm does the reverse decoding of the symbols encoded with the
   // edgebreaker method. The reverse decoding always keeps track of the active
   // edge identified by its opposite corner (active corner). New faces are
@@ -529,7 +533,8 @@ int MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity(
   // Additional active edges may be added as a result of topology split events.
   // They can be added in arbitrary order, but we always know the split symbol
   // id they belong to, so we can address them using this symbol id.
-  std::unordered_map<int, CornerIndex> topology_split_active_corners;
+  FlatHashMap<int, CornerIndex> topology_split_active_corners;
+  topology_split_active_corners.reserve(topology_split_data_.size());
 
   // Vector used for storing vertices that were marked as isolated during the
   // decoding process. Currently used only when the mesh doesn't contain any
@@ -914,6 +919,7 @@ template <class TraversalDecoder>
 int32_t
 MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeHoleAndTopologySplitEvents(
     DecoderBuffer *decoder_buffer) {
+  DRACO_TRACE_ZONE("DecodeTopologySplitEvents");
   // Prepare a new decoder from the provided buffer offset.
   uint32_t num_topology_splits;
 #ifdef DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED
@@ -1101,6 +1107,7 @@ bool MeshEdgebreakerDecoderImpl<
 template <class TraversalDecoder>
 bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::AssignPointsToCorners(
     int num_connectivity_verts) {
+  DRACO_TRACE_ZONE("AssignPointsToCorners");
   // Map between the existing and deduplicated point ids.
   // Note that at this point we have one point id for each corner of the
   // mesh so there is corner_table_->num_corners() point ids.
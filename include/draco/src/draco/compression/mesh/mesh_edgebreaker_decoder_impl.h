@@ -15,7 +15,6 @@
 #ifndef DRACO_COMPRESSION_MESH_MESH_EDGEBREAKER_DECODER_IMPL_H_
 #define DRACO_COMPRESSION_MESH_MESH_EDGEBREAKER_DECODER_IMPL_H_
 
-#include <unordered_map>
 #include <unordered_set>
 
 #include "draco/compression/attributes/mesh_attribute_indices_encoding_data.h"
@@ -23,6 +22,7 @@
 #include "draco/compression/mesh/mesh_edgebreaker_shared.h"
 #include "draco/compression/mesh/traverser/mesh_traversal_sequencer.h"
 #include "draco/core/decoder_buffer.h"
+#include "draco/core/flat_hash_map.h"
 #include "draco/draco_features.h"
 #include "draco/mesh/corner_table.h"
 #include "draco/mesh/mesh_attribute_corner_table.h"
@@ -186,7 +186,7 @@ class MeshEdgebreakerDecoderImpl : public MeshEdgebreakerDecoderImplInterface {
   int num_new_vertices_;
   // For every newly added vertex, this array stores it's mapping to the
   // parent vertex id of the encoded mesh.
-  std::unordered_map<int, int> new_to_parent_vertex_map_;
+  FlatHashMap<int, int> new_to_parent_vertex_map_;
   // The number of vertices that were encoded (can be different from the number
   // of vertices of the input mesh).
   int num_encoded_vertices_;
@@ -15,14 +15,13 @@
 #ifndef DRACO_COMPRESSION_MESH_MESH_EDGEBREAKER_ENCODER_IMPL_H_
 #define DRACO_COMPRESSION_MESH_MESH_EDGEBREAKER_ENCODER_IMPL_H_
 
-#include <unordered_map>
-
 #include "draco/compression/attributes/mesh_attribute_indices_encoding_data.h"
 #include "draco/compression/config/compression_shared.h"
 #include "draco/compression/mesh/mesh_edgebreaker_encoder_impl_interface.h"
 #include "draco/compression/mesh/mesh_edgebreaker_shared.h"
 #include "draco/compression/mesh/traverser/mesh_traversal_sequencer.h"
 #include "draco/core/encoder_buffer.h"
+#include "draco/core/flat_hash_map.h"
 #include "draco/mesh/mesh_attribute_corner_table.h"
 
 namespace draco {
@@ -162,7 +161,7 @@ class MeshEdgebreakerEncoderImpl : public MeshEdgebreakerEncoderImplInterface {
   std::vector<TopologySplitEventData> topology_split_event_data_;
   // Map between face_id and symbol_id. Contains entries only for faces that
   // were encoded with TOPOLOGY_S symbol.
-  std::unordered_map<int, int> face_to_split_symbol_map_;
+  FlatHashMap<int, int> face_to_split_symbol_map_;
 
   // Array for marking holes that has been reached during the traversal.
   std::vector<bool> visited_holes_;
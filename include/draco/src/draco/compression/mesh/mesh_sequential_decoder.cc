@@ -14,9 +14,12 @@
 //
 #include "draco/compression/mesh/mesh_sequential_decoder.h"
 
+#include <cstring>
+
 #include "draco/compression/attributes/linear_sequencer.h"
 #include "draco/compression/attributes/sequential_attribute_decoders_controller.h"
 #include "draco/compression/entropy/symbol_decoding.h"
+#include "draco/core/trace.h"
 #include "draco/core/varint_decoding.h"
 
 namespace draco {
@@ -24,6 +27,7 @@ namespace draco {
 MeshSequentialDecoder::MeshSequentialDecoder() {}
 
 bool MeshSequentialDecoder::DecodeConnectivity() {
+  DRACO_TRACE_ZONE("DecodeConnectivity");
   uint32_t num_faces;
   uint32_t num_points;
 #ifdef DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED
@@ -70,58 +74,34 @@ bool MeshSequentialDecoder::DecodeConnectivity() {
       return false;
     }
   } else {
+    mesh()->SetNumFaces(num_faces);
+    Mesh::Face *const faces = mesh()->face_data();
     if (num_points < 256) {
       // Decode indices as uint8_t.
-      for (uint32_t i = 0; i < num_faces; ++i) {
-        Mesh::Face face;
-        for (int j = 0; j < 3; ++j) {
-          uint8_t val;
-          if (!buffer()->Decode(&val)) {
-            return false;
-          }
-          face[j] = val;
-        }
-        mesh()->AddFace(face);
+      if (!DecodeRawIndices<uint8_t>(num_faces, faces)) {
+        return false;
       }
     } else if (num_points < (1 << 16)) {
       // Decode indices as uint16_t.
-      for (uint32_t i = 0; i < num_faces; ++i) {
-        Mesh::Face face;
-        for (int j = 0; j < 3; ++j) {
-          uint16_t val;
-          if (!buffer()->Decode(&val)) {
-            return false;
-          }
-          face[j] = val;
-        }
-        mesh()->AddFace(face);
+      if (!DecodeRawIndices<uint16_t>(num_faces, faces)) {
+        return false;
       }
     } else if (num_points < (1 << 21) &&
                bitstream_version() >= DRACO_BITSTREAM_VERSION(2, 2)) {
       // Decode indices as uint32_t.
       for (uint32_t i = 0; i < num_faces; ++i) {
-        Mesh::Face face;
         for (int j = 0; j < 3; ++j) {
           uint32_t val;
           if (!DecodeVarint(&val, buffer())) {
             return false;
           }
-          face[j] = val;
+          faces[i][j] = val;
         }
-        mesh()->AddFace(face);
       }
     } else {
       // Decode faces as uint32_t (default).
-      for (uint32_t i = 0; i < num_faces; ++i) {
-        Mesh::Face face;
-        for (int j = 0; j < 3; ++j) {
-          uint32_t val;
-          if (!buffer()->Decode(&val)) {
-            return false;
-          }
-          face[j] = val;
-        }
-        mesh()->AddFace(face);
+      if (!DecodeRawIndices<uint32_t>(num_faces, faces)) {
+        return false;
       }
     }
   }
@@ -147,10 +127,11 @@ bool MeshSequentialDecoder::DecodeAndDecompressIndices(uint32_t num_faces) {
   }
   // Reconstruct the indices from the differences.
   // See MeshSequentialEncoder::CompressAndEncodeIndices() for more details.
+  mesh()->SetNumFaces(num_faces);
+  Mesh::Face *const faces = mesh()->face_data();
   int32_t last_index_value = 0;
   int vertex_index = 0;
   for (uint32_t i = 0; i < num_faces; ++i) {
-    Mesh::Face face;
     for (int j = 0; j < 3; ++j) {
       const uint32_t encoded_val = indices_buffer[vertex_index++];
       int32_t index_diff = (encoded_val >> 1);
@@ -158,12 +139,39 @@ bool MeshSequentialDecoder::DecodeAndDecompressIndices(uint32_t num_faces) {
         index_diff = -index_diff;
       }
       const int32_t index_value = index_diff + last_index_value;
-      face[j] = index_value;
+      faces[i][j] = index_value;
       last_index_value = index_value;
     }
-    mesh()->AddFace(face);
   }
   return true;
 }
 
+template <typename IndexT>
+bool MeshSequentialDecoder::DecodeRawIndices(uint32_t num_faces,
+                                             Mesh::Face *faces) {
+  const int64_t num_bytes = static_cast<int64_t>(num_faces) * 3 *
+                            static_cast<int64_t>(sizeof(IndexT));
+  if (buffer()->remaining_size() < num_bytes) {
+    return false;
+  }
+  const char *const src = buffer()->data_head();
+  if (sizeof(IndexT) == sizeof(PointIndex::ValueType) &&
+      sizeof(Mesh::Face) == 3 * sizeof(PointIndex::ValueType)) {
+    // The faces have the same layout as the encoded indices.
+    if (num_bytes > 0) {
+      memcpy(static_cast<void *>(faces), src, num_bytes);
+    }
+  } else {
+    for (uint32_t i = 0; i < num_faces; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        IndexT val;
+        memcpy(&val, src + (3 * i + j) * sizeof(IndexT), sizeof(IndexT));
+        faces[i][j] = val;
+      }
+    }
+  }
+  buffer()->Advance(num_bytes);
+  return true;
+}
+
 }  // namespace draco
@@ -32,6 +32,12 @@ class MeshSequentialDecoder : public MeshDecoder {
   // Decodes face indices that were compressed with an entropy code.
   // Returns false on error.
   bool DecodeAndDecompressIndices(uint32_t num_faces);
+
+  // Decodes |num_faces| faces stored as raw indices of type IndexT into
+  // |faces|. The size of the input is validated once for all indices.
+  // Returns false on error.
+  template <typename IndexT>
+  bool DecodeRawIndices(uint32_t num_faces, Mesh::Face *faces);
 };
 
 }  // namespace draco
@@ -17,9 +17,10 @@
 #ifndef DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_DYNAMIC_INTEGER_POINTS_KD_TREE_DECODER_H_
 #define DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_DYNAMIC_INTEGER_POINTS_KD_TREE_DECODER_H_
 
+#include <algorithm>
 #include <array>
 #include <memory>
-#include <stack>
+#include <vector>
 
 #include "draco/compression/bit_coders/adaptive_rans_bit_decoder.h"
 #include "draco/compression/bit_coders/direct_bit_decoder.h"
@@ -89,8 +90,12 @@ class DynamicIntegerPointsKdTreeDecoder {
         axes_(dimension, 0),
         // Init the stack with the maximum depth of the tree.
         // +1 for a second leaf.
-        base_stack_(32 * dimension + 1, VectorUint32(dimension, 0)),
-        levels_stack_(32 * dimension + 1, VectorUint32(dimension, 0)) {}
+        base_stack_((32 * dimension + 1) * dimension, 0),
+        levels_stack_((32 * dimension + 1) * dimension, 0) {
+    // Every split pushes at most two nodes and pops one, so the traversal
+    // never holds more than one pending node per tree level plus the root.
+    status_stack_.reserve(32 * dimension + 2);
+  }
 
   // Decodes a integer point cloud from |buffer|.
   template <class OutputIteratorT>
@@ -104,7 +109,7 @@ class DynamicIntegerPointsKdTreeDecoder {
   const uint32_t dimension() const { return dimension_; }
 
  private:
-  uint32_t GetAxis(uint32_t num_remaining_points, const VectorUint32 &levels,
+  uint32_t GetAxis(uint32_t num_remaining_points, const uint32_t *levels,
                    uint32_t last_axis);
 
   template <class OutputIteratorT>
@@ -136,8 +141,11 @@ class DynamicIntegerPointsKdTreeDecoder {
   HalfDecoder half_decoder_;
   VectorUint32 p_;
   VectorUint32 axes_;
-  std::vector<VectorUint32> base_stack_;
-  std::vector<VectorUint32> levels_stack_;
+  // Bases and levels of all tree depths stored contiguously, |dimension_|
+  // values per depth.
+  VectorUint32 base_stack_;
+  VectorUint32 levels_stack_;
+  std::vector<DecodingStatus> status_stack_;
 };
 
 // Decodes a point cloud from |buffer|.
@@ -196,7 +204,7 @@ bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodePoints(
 
 template <int compression_level_t>
 uint32_t DynamicIntegerPointsKdTreeDecoder<compression_level_t>::GetAxis(
-    uint32_t num_remaining_points, const VectorUint32 &levels,
+    uint32_t num_remaining_points, const uint32_t *levels,
     uint32_t last_axis) {
   if (!Policy::select_axis) {
     return DRACO_INCREMENT_MOD(last_axis, dimension_);
@@ -220,23 +228,21 @@ template <int compression_level_t>
 template <class OutputIteratorT>
 bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodeInternal(
     uint32_t num_points, OutputIteratorT &oit) {
-  typedef DecodingStatus Status;
-  base_stack_[0] = VectorUint32(dimension_, 0);
-  levels_stack_[0] = VectorUint32(dimension_, 0);
-  DecodingStatus init_status(num_points, 0, 0);
-  std::stack<Status> status_stack;
-  status_stack.push(init_status);
-
-  // TODO(b/199760123): Use preallocated vector instead of stack.
-  while (!status_stack.empty()) {
-    const DecodingStatus status = status_stack.top();
-    status_stack.pop();
+  std::fill(base_stack_.begin(), base_stack_.begin() + dimension_, 0);
+  std::fill(levels_stack_.begin(), levels_stack_.begin() + dimension_, 0);
+  status_stack_.clear();
+  status_stack_.push_back(DecodingStatus(num_points, 0, 0));
+
+  while (!status_stack_.empty()) {
+    const DecodingStatus status = status_stack_.back();
+    status_stack_.pop_back();
 
     const uint32_t num_remaining_points = status.num_remaining_points;
     const uint32_t last_axis = status.last_axis;
     const uint32_t stack_pos = status.stack_pos;
-    const VectorUint32 &old_base = base_stack_[stack_pos];
-    const VectorUint32 &levels = levels_stack_[stack_pos];
+    const uint32_t *const old_base =
+        base_stack_.data() + stack_pos * dimension_;
+    uint32_t *const levels = levels_stack_.data() + stack_pos * dimension_;
 
     if (num_remaining_points > num_points) {
       return false;
@@ -251,11 +257,13 @@ bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodeInternal(
 
     // All axes have been fully subdivided, just output points.
     if ((bit_length_ - level) == 0) {
+      // All points of the leaf share the same value, build it only once.
+      std::copy(old_base, old_base + dimension_, p_.begin());
       for (uint32_t i = 0; i < num_remaining_points; i++) {
-        *oit = old_base;
+        *oit = p_;
         ++oit;
-        ++num_decoded_points_;
       }
+      num_decoded_points_ += num_remaining_points;
       continue;
     }
 
@@ -290,10 +298,14 @@ bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodeInternal(
       return false;
     }
 
+    // Each split increases one level that is still below |bit_length_|, so
+    // |stack_pos + 1| never exceeds the 32 * dimension_ depths reserved.
     const int num_remaining_bits = bit_length_ - level;
     const uint32_t modifier = 1 << (num_remaining_bits - 1);
-    base_stack_[stack_pos + 1] = old_base;         // copy
-    base_stack_[stack_pos + 1][axis] += modifier;  // new base
+    uint32_t *const new_base =
+        base_stack_.data() + (stack_pos + 1) * dimension_;
+    std::copy(old_base, old_base + dimension_, new_base);
+    new_base[axis] += modifier;
 
     const int incoming_bits = MostSignificantBit(num_remaining_points);
 
@@ -309,13 +321,15 @@ bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodeInternal(
       }
     }
 
-    levels_stack_[stack_pos][axis] += 1;
-    levels_stack_[stack_pos + 1] = levels_stack_[stack_pos];  // copy
+    levels[axis] += 1;
+    std::copy(levels, levels + dimension_,
+              levels_stack_.data() + (stack_pos + 1) * dimension_);
     if (first_half) {
-      status_stack.push(DecodingStatus(first_half, axis, stack_pos));
+      status_stack_.push_back(DecodingStatus(first_half, axis, stack_pos));
     }
     if (second_half) {
-      status_stack.push(DecodingStatus(second_half, axis, stack_pos + 1));
+      status_stack_.push_back(
+          DecodingStatus(second_half, axis, stack_pos + 1));
     }
   }
   return true;
@@ -14,6 +14,7 @@
 //
 #include "draco/compression/point_cloud/point_cloud_decoder.h"
 
+#include "draco/core/trace.h"
 #include "draco/metadata/metadata_decoder.h"
 
 namespace draco {
@@ -27,6 +28,7 @@ PointCloudDecoder::PointCloudDecoder()
 
 Status PointCloudDecoder::DecodeHeader(DecoderBuffer *buffer,
                                        DracoHeader *out_header) {
+  DRACO_TRACE_ZONE("DecodeHeader");
   constexpr char kIoErrorMsg[] = "Failed to parse Draco header.";
   if (!buffer->Decode(out_header->draco_string, 5)) {
     return Status(Status::IO_ERROR, kIoErrorMsg);
@@ -67,6 +69,7 @@ Status PointCloudDecoder::Decode(const DecoderOptions &options,
                                  DecoderBuffer *in_buffer,
                                  PointCloud *out_point_cloud) {
   options_ = &options;
+  resolved_options_.Resolve(options);
   buffer_ = in_buffer;
   point_cloud_ = out_point_cloud;
   DracoHeader header;
@@ -122,6 +125,15 @@ Status PointCloudDecoder::Decode(const DecoderOptions &options,
   if (!DecodePointAttributes()) {
     return Status(Status::DRACO_ERROR, "Failed to decode point attributes.");
   }
+  if (!resolved_options_.decode_all_attributes()) {
+    // Remove the attributes that were not requested. Their values were either
+    // skipped or decoded only because the encoding method required it.
+    for (int i = point_cloud_->num_attributes() - 1; i >= 0; --i) {
+      if (!resolved_options_.IsAttributeDecoded(*point_cloud_->attribute(i))) {
+        point_cloud_->DeleteAttribute(i);
+      }
+    }
+  }
   return OkStatus();
 }
 
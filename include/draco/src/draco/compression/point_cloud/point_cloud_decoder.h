@@ -78,6 +78,10 @@ class PointCloudDecoder {
 
   DecoderBuffer *buffer() { return buffer_; }
   const DecoderOptions *options() const { return options_; }
+  // Options used during decoding, resolved from options() by Decode().
+  const ResolvedDecoderOptions &resolved_options() const {
+    return resolved_options_;
+  }
 
  protected:
   // Can be implemented by derived classes to perform any custom initialization
@@ -111,6 +115,7 @@ class PointCloudDecoder {
   uint8_t version_minor_;
 
   const DecoderOptions *options_;
+  ResolvedDecoderOptions resolved_options_;
 };
 
 }  // namespace draco
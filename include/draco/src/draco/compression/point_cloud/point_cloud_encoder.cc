@@ -14,6 +14,7 @@
 //
 #include "draco/compression/point_cloud/point_cloud_encoder.h"
 
+#include "draco/core/parallel_tasks.h"
 #include "draco/metadata/metadata_encoder.h"
 
 namespace draco {
@@ -159,11 +160,39 @@ bool PointCloudEncoder::GenerateAttributesEncoders() {
 }
 
 bool PointCloudEncoder::EncodeAllAttributes() {
+  const int num_threads = options_->GetGlobalInt("num_encoding_threads", 1);
+  const int num_encoders =
+      static_cast<int>(attributes_encoder_ids_order_.size());
+  if (num_threads <= 1 || num_encoders <= 1) {
+    for (int att_encoder_id : attributes_encoder_ids_order_) {
+      if (!attributes_encoders_[att_encoder_id]->EncodeAttributes(buffer_)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Attribute encoders only depend on the portable attributes of their parents
+  // which are created when the encoders are prepared. After preparing all
+  // encoders in the encoding order, the remaining (and by far most expensive)
+  // part can run in parallel. Each encoder writes to its own buffer and the
+  // buffers are concatenated in the encoding order, so the output doesn't
+  // depend on the number of threads.
   for (int att_encoder_id : attributes_encoder_ids_order_) {
-    if (!attributes_encoders_[att_encoder_id]->EncodeAttributes(buffer_)) {
+    if (!attributes_encoders_[att_encoder_id]->PrepareAttributes()) {
       return false;
     }
   }
+  std::vector<EncoderBuffer> buffers(num_encoders);
+  if (!RunParallelTasks(num_encoders, num_threads, [&](int i) {
+        return attributes_encoders_[attributes_encoder_ids_order_[i]]
+            ->EncodePreparedAttributes(&buffers[i]);
+      })) {
+    return false;
+  }
+  for (const EncoderBuffer &buffer : buffers) {
+    buffer_->Encode(buffer.data(), buffer.size());
+  }
   return true;
 }
 
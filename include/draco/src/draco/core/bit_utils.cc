@@ -14,6 +14,8 @@
 //
 #include "draco/core/bit_utils.h"
 
+#include "draco/core/vector_kernels.h"
+
 namespace draco {
 
 void ConvertSignedIntsToSymbols(const int32_t *in, int in_values,
@@ -28,9 +30,7 @@ void ConvertSignedIntsToSymbols(const int32_t *in, int in_values,
 
 void ConvertSymbolsToSignedInts(const uint32_t *in, int in_values,
                                 int32_t *out) {
-  for (int i = 0; i < in_values; ++i) {
-    out[i] = ConvertSymbolToSignedInt(in[i]);
-  }
+  GetVectorKernels().symbols_to_signed_ints(in, in_values, out);
 }
 
 }  // namespace draco
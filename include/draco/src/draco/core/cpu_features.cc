@@ -0,0 +1,122 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/cpu_features.h"
+
+#if defined(DRACO_X86_SIMD_SUPPORTED) && defined(_MSC_VER) && \
+    !defined(__clang__)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace draco {
+
+namespace {
+
+#if defined(DRACO_X86_SIMD_SUPPORTED) && defined(_MSC_VER) && \
+    !defined(__clang__)
+CpuFeatures DetectCpuFeatures() {
+  CpuFeatures features;
+  int info[4];
+  __cpuid(info, 0);
+  const int max_leaf = info[0];
+  if (max_leaf < 1) {
+    return features;
+  }
+  __cpuid(info, 1);
+  features.sse4_1 = (info[2] & (1 << 19)) != 0;
+  const bool os_saves_ymm =
+      (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 &&
+      (_xgetbv(0) & 0x6) == 0x6;
+  if (!os_saves_ymm || max_leaf < 7) {
+    return features;
+  }
+  const bool os_saves_zmm = (_xgetbv(0) & 0xe0) == 0xe0;
+  __cpuidex(info, 7, 0);
+  features.avx2 = (info[1] & (1 << 5)) != 0;
+  features.avx512 = os_saves_zmm && (info[1] & (1 << 16)) != 0;
+  return features;
+}
+#elif defined(DRACO_X86_SIMD_SUPPORTED)
+CpuFeatures DetectCpuFeatures() {
+  // The builtins also check that the OS saves the AVX registers.
+  __builtin_cpu_init();
+  CpuFeatures features;
+  features.sse4_1 = __builtin_cpu_supports("sse4.1");
+  features.avx2 = __builtin_cpu_supports("avx2");
+  features.avx512 = __builtin_cpu_supports("avx512f");
+  return features;
+}
+#else
+CpuFeatures DetectCpuFeatures() {
+  CpuFeatures features;
+#ifdef DRACO_NEON_SUPPORTED
+  features.neon = true;
+#endif
+  return features;
+}
+#endif
+
+}  // namespace
+
+const CpuFeatures &GetCpuFeatures() {
+  static const CpuFeatures features = DetectCpuFeatures();
+  return features;
+}
+
+bool IsCpuLevelSupported(CpuLevel level) {
+  const CpuFeatures &features = GetCpuFeatures();
+  switch (level) {
+    case CPU_LEVEL_SCALAR:
+      return true;
+    case CPU_LEVEL_SSE4_1:
+      return features.sse4_1;
+    case CPU_LEVEL_AVX2:
+      return features.avx2;
+    case CPU_LEVEL_AVX512:
+      return features.avx512;
+    case CPU_LEVEL_NEON:
+      return features.neon;
+    default:
+      return false;
+  }
+}
+
+CpuLevel GetBestCpuLevel() {
+  for (int level = NUM_CPU_LEVELS - 1; level > CPU_LEVEL_SCALAR; --level) {
+    if (IsCpuLevelSupported(static_cast<CpuLevel>(level))) {
+      return static_cast<CpuLevel>(level);
+    }
+  }
+  return CPU_LEVEL_SCALAR;
+}
+
+const char *CpuLevelName(CpuLevel level) {
+  switch (level) {
+    case CPU_LEVEL_SCALAR:
+      return "scalar";
+    case CPU_LEVEL_SSE4_1:
+      return "sse4.1";
+    case CPU_LEVEL_AVX2:
+      return "avx2";
+    case CPU_LEVEL_AVX512:
+      return "avx512";
+    case CPU_LEVEL_NEON:
+      return "neon";
+    default:
+      return "unknown";
+  }
+}
+
+}  // namespace draco
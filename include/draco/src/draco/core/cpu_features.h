@@ -0,0 +1,64 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_CPU_FEATURES_H_
+#define DRACO_CORE_CPU_FEATURES_H_
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#define DRACO_X86_SIMD_SUPPORTED
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define DRACO_NEON_SUPPORTED
+#endif
+
+namespace draco {
+
+// Instruction set levels that have their own kernel implementations, ordered
+// from the least to the most capable one on each architecture.
+enum CpuLevel {
+  CPU_LEVEL_SCALAR = 0,
+  CPU_LEVEL_SSE4_1,
+  CPU_LEVEL_AVX2,
+  CPU_LEVEL_AVX512,
+  CPU_LEVEL_NEON,
+  NUM_CPU_LEVELS
+};
+
+// Instruction set extensions of the CPU the library is running on. AVX2 and
+// AVX-512 are only reported when the operating system also saves the wider
+// registers.
+struct CpuFeatures {
+  bool sse4_1 = false;
+  bool avx2 = false;
+  // AVX-512 Foundation.
+  bool avx512 = false;
+  // Always available on 64-bit ARM.
+  bool neon = false;
+};
+
+// Returns the features of the current CPU. Detection runs on the first call.
+const CpuFeatures &GetCpuFeatures();
+
+// Returns true when |level| was compiled in and is supported by the CPU.
+bool IsCpuLevelSupported(CpuLevel level);
+
+// Returns the most capable supported level.
+CpuLevel GetBestCpuLevel();
+
+// Returns a short lower case name of |level| such as "avx2".
+const char *CpuLevelName(CpuLevel level);
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_CPU_FEATURES_H_
@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "draco/core/draco_types.h"
+#include "draco/core/memory_resource.h"
 
 namespace draco {
 
@@ -72,7 +73,8 @@ class DataBuffer {
   void set_buffer_id(int64_t buffer_id) { descriptor_.buffer_id = buffer_id; }
 
  private:
-  std::vector<uint8_t> data_;
+  // Allocated from the current memory resource, see memory_resource.h.
+  std::vector<uint8_t, ResourceAllocator<uint8_t>> data_;
   // Counter incremented by Update() calls.
   DataBufferDescriptor descriptor_;
 };
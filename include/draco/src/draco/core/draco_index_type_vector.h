@@ -20,19 +20,22 @@
 #include <vector>
 
 #include "draco/core/draco_index_type.h"
+#include "draco/core/memory_resource.h"
 
 namespace draco {
 
 // A wrapper around the standard std::vector that supports indexing of the
 // vector entries using the strongly typed indices as defined in
-// draco_index_type.h .
+// draco_index_type.h . The storage is allocated from the current memory
+// resource of the thread that created the vector (see memory_resource.h).
 // TODO(ostava): Make the interface more complete. It's currently missing
 // features such as iterators.
 template <class IndexTypeT, class ValueTypeT>
 class IndexTypeVector {
  public:
-  typedef typename std::vector<ValueTypeT>::const_reference const_reference;
-  typedef typename std::vector<ValueTypeT>::reference reference;
+  typedef std::vector<ValueTypeT, ResourceAllocator<ValueTypeT>> VectorType;
+  typedef typename VectorType::const_reference const_reference;
+  typedef typename VectorType::reference reference;
 
   IndexTypeVector() {}
   explicit IndexTypeVector(size_t size) : vector_(size) {}
@@ -71,10 +74,11 @@ class IndexTypeVector {
   inline const_reference at(const IndexTypeT &index) const {
     return vector_[index.value()];
   }
+  ValueTypeT *data() { return vector_.data(); }
   const ValueTypeT *data() const { return vector_.data(); }
 
  private:
-  std::vector<ValueTypeT> vector_;
+  VectorType vector_;
 };
 
 }  // namespace draco
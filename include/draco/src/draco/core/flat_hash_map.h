@@ -0,0 +1,224 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_FLAT_HASH_MAP_H_
+#define DRACO_CORE_FLAT_HASH_MAP_H_
+
+#include <stdint.h>
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace draco {
+
+// Hash map storing all entries in a single flat array using open addressing
+// with linear probing. The capacity is always a power of two and the map is
+// grown once it is 3/4 full. Compared to std::unordered_map it does not
+// allocate a node per entry, which makes it much faster for the small key and
+// value types used by the mesh codecs.
+// The interface follows std::unordered_map for the supported subset. Erasing
+// of single entries is not supported and iterators are invalidated whenever
+// a new entry is inserted.
+template <typename KeyT, typename ValueT, typename HashT = std::hash<KeyT>>
+class FlatHashMap {
+ public:
+  typedef std::pair<KeyT, ValueT> value_type;
+
+  template <typename EntryT>
+  class Iterator {
+   public:
+    Iterator(EntryT *entry, const uint8_t *used, const uint8_t *used_end)
+        : entry_(entry), used_(used), used_end_(used_end) {
+      SkipUnused();
+    }
+    EntryT &operator*() const { return *entry_; }
+    EntryT *operator->() const { return entry_; }
+    Iterator &operator++() {
+      ++entry_;
+      ++used_;
+      SkipUnused();
+      return *this;
+    }
+    bool operator==(const Iterator &other) const {
+      return entry_ == other.entry_;
+    }
+    bool operator!=(const Iterator &other) const {
+      return entry_ != other.entry_;
+    }
+
+   private:
+    void SkipUnused() {
+      while (used_ != used_end_ && !*used_) {
+        ++entry_;
+        ++used_;
+      }
+    }
+
+    EntryT *entry_;
+    const uint8_t *used_;
+    const uint8_t *used_end_;
+  };
+
+  typedef Iterator<value_type> iterator;
+  typedef Iterator<const value_type> const_iterator;
+
+  FlatHashMap() : num_entries_(0), shift_(64) {}
+
+  size_t size() const { return num_entries_; }
+  bool empty() const { return num_entries_ == 0; }
+
+  // Removes all entries but keeps the allocated capacity.
+  void clear() {
+    if (num_entries_ > 0) {
+      used_.assign(used_.size(), 0);
+      num_entries_ = 0;
+    }
+  }
+
+  // Makes sure |num_entries| can be stored without growing the map.
+  void reserve(size_t num_entries) {
+    size_t capacity = 16;
+    while (capacity - capacity / 4 < num_entries) {
+      capacity <<= 1;
+    }
+    if (capacity > entries_.size()) {
+      Rehash(capacity);
+    }
+  }
+
+  iterator begin() { return MakeIterator(0); }
+  iterator end() { return MakeIterator(entries_.size()); }
+  const_iterator begin() const { return MakeIterator(0); }
+  const_iterator end() const { return MakeIterator(entries_.size()); }
+
+  iterator find(const KeyT &key) {
+    return MakeIterator(FindSlot(key));
+  }
+  const_iterator find(const KeyT &key) const {
+    return MakeIterator(FindSlot(key));
+  }
+  size_t count(const KeyT &key) const {
+    return FindSlot(key) != entries_.size() ? 1 : 0;
+  }
+
+  // Inserts |kv| unless an entry with the same key exists already. Returns the
+  // iterator to the entry with the key and whether the insertion took place.
+  std::pair<iterator, bool> insert(const value_type &kv) {
+    bool inserted;
+    const size_t slot = InsertSlot(kv.first, &inserted);
+    if (inserted) {
+      entries_[slot].second = kv.second;
+    }
+    return std::make_pair(MakeIterator(slot), inserted);
+  }
+
+  ValueT &operator[](const KeyT &key) {
+    bool inserted;
+    const size_t slot = InsertSlot(key, &inserted);
+    if (inserted) {
+      entries_[slot].second = ValueT();
+    }
+    return entries_[slot].second;
+  }
+
+ private:
+  size_t SlotForHash(size_t hash) const {
+    // Fibonacci hashing spreads keys with poor std::hash results (such as
+    // consecutive integers) over the whole table.
+    return static_cast<size_t>(
+        (static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> shift_);
+  }
+
+  // Returns the slot of |key| or entries_.size() when it's not in the map.
+  size_t FindSlot(const KeyT &key) const {
+    if (num_entries_ == 0) {
+      return entries_.size();
+    }
+    const size_t mask = entries_.size() - 1;
+    for (size_t slot = SlotForHash(hasher_(key));; slot = (slot + 1) & mask) {
+      if (!used_[slot]) {
+        return entries_.size();
+      }
+      if (entries_[slot].first == key) {
+        return slot;
+      }
+    }
+  }
+
+  // Returns the slot of |key|, claiming a new one if the key is not in the
+  // map yet.
+  size_t InsertSlot(const KeyT &key, bool *inserted) {
+    if (num_entries_ + 1 > entries_.size() - entries_.size() / 4) {
+      Rehash(entries_.empty() ? 16 : entries_.size() * 2);
+    }
+    const size_t mask = entries_.size() - 1;
+    size_t slot = SlotForHash(hasher_(key));
+    for (; used_[slot]; slot = (slot + 1) & mask) {
+      if (entries_[slot].first == key) {
+        *inserted = false;
+        return slot;
+      }
+    }
+    used_[slot] = 1;
+    entries_[slot].first = key;
+    ++num_entries_;
+    *inserted = true;
+    return slot;
+  }
+
+  void Rehash(size_t capacity) {
+    std::vector<value_type> old_entries(capacity);
+    std::vector<uint8_t> old_used(capacity, 0);
+    old_entries.swap(entries_);
+    old_used.swap(used_);
+    shift_ = 64;
+    for (size_t c = capacity; c > 1; c >>= 1) {
+      --shift_;
+    }
+    const size_t mask = capacity - 1;
+    for (size_t i = 0; i < old_entries.size(); ++i) {
+      if (!old_used[i]) {
+        continue;
+      }
+      size_t slot = SlotForHash(hasher_(old_entries[i].first));
+      while (used_[slot]) {
+        slot = (slot + 1) & mask;
+      }
+      used_[slot] = 1;
+      entries_[slot] = std::move(old_entries[i]);
+    }
+  }
+
+  iterator MakeIterator(size_t slot) {
+    return iterator(entries_.data() + slot, used_.data() + slot,
+                    used_.data() + used_.size());
+  }
+  const_iterator MakeIterator(size_t slot) const {
+    return const_iterator(entries_.data() + slot, used_.data() + slot,
+                          used_.data() + used_.size());
+  }
+
+  std::vector<value_type> entries_;
+  std::vector<uint8_t> used_;
+  size_t num_entries_;
+  // Number of bits dropped from the 64-bit hash to get a slot index.
+  int shift_;
+  HashT hasher_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_FLAT_HASH_MAP_H_
@@ -0,0 +1,187 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/memory_resource.h"
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+
+namespace draco {
+
+namespace {
+
+class HeapMemoryResource : public MemoryResource {
+ public:
+  void *Allocate(size_t size, size_t alignment) override {
+    if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      return ::operator new(size, std::align_val_t(alignment));
+    }
+    return ::operator new(size);
+  }
+  void Deallocate(void *ptr, size_t /* size */, size_t alignment) override {
+    if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      ::operator delete(ptr, std::align_val_t(alignment));
+      return;
+    }
+    ::operator delete(ptr);
+  }
+};
+
+HeapMemoryResource heap_memory_resource;
+std::atomic<MemoryResource *> default_memory_resource(&heap_memory_resource);
+thread_local MemoryResource *current_memory_resource = nullptr;
+
+// Blocks never grow beyond this size unless a single allocation needs more.
+constexpr size_t kMaxArenaBlockSize = 16 * 1024 * 1024;
+
+}  // namespace
+
+MemoryResource *GetHeapMemoryResource() { return &heap_memory_resource; }
+
+void SetDefaultMemoryResource(MemoryResource *resource) {
+  default_memory_resource.store(resource ? resource : &heap_memory_resource);
+}
+
+MemoryResource *GetDefaultMemoryResource() {
+  return default_memory_resource.load(std::memory_order_relaxed);
+}
+
+MemoryResource *GetCurrentMemoryResource() {
+  if (current_memory_resource) {
+    return current_memory_resource;
+  }
+  return GetDefaultMemoryResource();
+}
+
+ScopedMemoryResource::ScopedMemoryResource(MemoryResource *resource)
+    : previous_resource_(current_memory_resource) {
+  current_memory_resource = resource;
+}
+
+ScopedMemoryResource::~ScopedMemoryResource() {
+  current_memory_resource = previous_resource_;
+}
+
+ArenaMemoryResource::ArenaMemoryResource(MemoryResource *upstream,
+                                         size_t initial_block_size)
+    : upstream_(upstream ? upstream : GetDefaultMemoryResource()),
+      offset_(0),
+      next_block_size_(std::max<size_t>(initial_block_size, 1024)),
+      reserved_size_(0) {}
+
+ArenaMemoryResource::~ArenaMemoryResource() {
+  for (const Block &block : blocks_) {
+    ReleaseBlock(block);
+  }
+}
+
+void *ArenaMemoryResource::Allocate(size_t size, size_t alignment) {
+  if (!blocks_.empty()) {
+    const Block &block = blocks_.back();
+    const uintptr_t start = reinterpret_cast<uintptr_t>(block.data);
+    const uintptr_t ptr = (start + offset_ + alignment - 1) & ~(alignment - 1);
+    if (ptr - start <= block.size && size <= block.size - (ptr - start)) {
+      offset_ = ptr - start + size;
+      return reinterpret_cast<void *>(ptr);
+    }
+  }
+  // Start a new block. Allocations that don't fit the regular block size get a
+  // block of their own size.
+  size_t block_size = next_block_size_;
+  if (block_size < size + alignment) {
+    block_size = size + alignment;
+  }
+  next_block_size_ = std::min(next_block_size_ * 2, kMaxArenaBlockSize);
+  Block block;
+  block.data = static_cast<uint8_t *>(
+      upstream_->Allocate(block_size, alignof(std::max_align_t)));
+  block.size = block_size;
+  blocks_.push_back(block);
+  reserved_size_ += block_size;
+  offset_ = 0;
+  return Allocate(size, alignment);
+}
+
+void ArenaMemoryResource::Deallocate(void *ptr, size_t size,
+                                     size_t /* alignment */) {
+  if (blocks_.empty()) {
+    return;
+  }
+  // Only the most recent allocation can be given back to the arena.
+  uint8_t *const block_data = blocks_.back().data;
+  uint8_t *const data = static_cast<uint8_t *>(ptr);
+  if (data >= block_data && data + size == block_data + offset_) {
+    offset_ = data - block_data;
+  }
+}
+
+void ArenaMemoryResource::Reset() {
+  offset_ = 0;
+  if (blocks_.size() <= 1) {
+    return;
+  }
+  // Replace all blocks with a single one big enough for everything that was
+  // allocated, so that repeating the same work doesn't need new blocks.
+  const size_t total_size = reserved_size_;
+  for (const Block &block : blocks_) {
+    ReleaseBlock(block);
+  }
+  blocks_.clear();
+  Block block;
+  block.data = static_cast<uint8_t *>(
+      upstream_->Allocate(total_size, alignof(std::max_align_t)));
+  block.size = total_size;
+  blocks_.push_back(block);
+  reserved_size_ = total_size;
+}
+
+void ArenaMemoryResource::ReleaseBlock(const Block &block) {
+  upstream_->Deallocate(block.data, block.size, alignof(std::max_align_t));
+  reserved_size_ -= block.size;
+}
+
+CountingMemoryResource::CountingMemoryResource(MemoryResource *upstream)
+    : upstream_(upstream ? upstream : GetDefaultMemoryResource()),
+      num_allocations_(0),
+      allocated_bytes_(0),
+      live_bytes_(0),
+      peak_bytes_(0) {}
+
+void *CountingMemoryResource::Allocate(size_t size, size_t alignment) {
+  void *const ptr = upstream_->Allocate(size, alignment);
+  num_allocations_.fetch_add(1, std::memory_order_relaxed);
+  allocated_bytes_.fetch_add(size, std::memory_order_relaxed);
+  const uint64_t live =
+      live_bytes_.fetch_add(size, std::memory_order_relaxed) + size;
+  uint64_t peak = peak_bytes_.load(std::memory_order_relaxed);
+  while (live > peak && !peak_bytes_.compare_exchange_weak(
+                            peak, live, std::memory_order_relaxed)) {
+  }
+  return ptr;
+}
+
+void CountingMemoryResource::Deallocate(void *ptr, size_t size,
+                                        size_t alignment) {
+  live_bytes_.fetch_sub(size, std::memory_order_relaxed);
+  upstream_->Deallocate(ptr, size, alignment);
+}
+
+void CountingMemoryResource::ResetCounters() {
+  num_allocations_.store(0);
+  allocated_bytes_.store(0);
+  peak_bytes_.store(live_bytes_.load());
+}
+
+}  // namespace draco
@@ -0,0 +1,178 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_MEMORY_RESOURCE_H_
+#define DRACO_CORE_MEMORY_RESOURCE_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "draco/core/macros.h"
+
+namespace draco {
+
+// Interface of the memory source used by the storage of DataBuffer and
+// IndexTypeVector (and therefore by attributes and corner tables).
+class MemoryResource {
+ public:
+  virtual ~MemoryResource() = default;
+  virtual void *Allocate(size_t size, size_t alignment) = 0;
+  virtual void Deallocate(void *ptr, size_t size, size_t alignment) = 0;
+};
+
+// Returns the memory resource that allocates from the global heap.
+MemoryResource *GetHeapMemoryResource();
+
+// Sets the resource used by all threads that don't have a scoped resource.
+// Passing nullptr restores the global heap. Memory is always released to the
+// resource it was allocated from, so the default can be changed at any time
+// as long as the previous resource outlives its allocations.
+void SetDefaultMemoryResource(MemoryResource *resource);
+MemoryResource *GetDefaultMemoryResource();
+
+// Returns the resource used for containers created on the calling thread.
+MemoryResource *GetCurrentMemoryResource();
+
+// Makes |resource| the current memory resource of the calling thread for the
+// lifetime of the object.
+class ScopedMemoryResource {
+ public:
+  explicit ScopedMemoryResource(MemoryResource *resource);
+  ~ScopedMemoryResource();
+
+ private:
+  MemoryResource *previous_resource_;
+  DISALLOW_COPY_AND_ASSIGN(ScopedMemoryResource)
+};
+
+// Bump allocator serving allocations from large blocks of the upstream
+// resource. Individual deallocations are ignored (except for the most recent
+// allocation) and all memory is released at once by Reset() or when the arena
+// is destroyed, so the arena must outlive every container allocated from it.
+// Not thread safe, each thread must use its own arena.
+class ArenaMemoryResource : public MemoryResource {
+ public:
+  explicit ArenaMemoryResource(MemoryResource *upstream = nullptr,
+                               size_t initial_block_size = 16 * 1024);
+  ~ArenaMemoryResource() override;
+
+  void *Allocate(size_t size, size_t alignment) override;
+  void Deallocate(void *ptr, size_t size, size_t alignment) override;
+
+  // Releases all allocations. The memory is kept for reuse as a single block.
+  void Reset();
+
+  // Returns the number of bytes currently reserved from the upstream resource.
+  size_t reserved_size() const { return reserved_size_; }
+
+ private:
+  struct Block {
+    uint8_t *data;
+    size_t size;
+  };
+
+  void ReleaseBlock(const Block &block);
+
+  MemoryResource *upstream_;
+  std::vector<Block> blocks_;
+  // Offset of the first free byte in the last block.
+  size_t offset_;
+  size_t next_block_size_;
+  size_t reserved_size_;
+  DISALLOW_COPY_AND_ASSIGN(ArenaMemoryResource)
+};
+
+// Forwards to an upstream resource and counts the allocations going through
+// it. The counters are atomic so that one instance can be shared by several
+// threads, and instances can be chained to measure nested scopes (e.g. every
+// primitive of an import and the import as a whole).
+class CountingMemoryResource : public MemoryResource {
+ public:
+  explicit CountingMemoryResource(MemoryResource *upstream = nullptr);
+
+  void *Allocate(size_t size, size_t alignment) override;
+  void Deallocate(void *ptr, size_t size, size_t alignment) override;
+
+  // Zeroes the allocation counters and restarts the peak from the currently
+  // live bytes, so that consecutive stages can be measured separately.
+  void ResetCounters();
+
+  // Number of allocations and their total size since the last reset.
+  uint64_t num_allocations() const { return num_allocations_.load(); }
+  uint64_t allocated_bytes() const { return allocated_bytes_.load(); }
+  // Bytes allocated and not yet released, and their maximum since the last
+  // reset.
+  uint64_t live_bytes() const { return live_bytes_.load(); }
+  uint64_t peak_bytes() const { return peak_bytes_.load(); }
+
+ private:
+  MemoryResource *upstream_;
+  std::atomic<uint64_t> num_allocations_;
+  std::atomic<uint64_t> allocated_bytes_;
+  std::atomic<uint64_t> live_bytes_;
+  std::atomic<uint64_t> peak_bytes_;
+  DISALLOW_COPY_AND_ASSIGN(CountingMemoryResource)
+};
+
+// Standard allocator forwarding to a MemoryResource. The resource is captured
+// when the allocator is created, by default it's the current resource of the
+// calling thread. Moved containers keep the resource of their source, copied
+// containers use the current resource of the copying thread.
+template <typename T>
+class ResourceAllocator {
+ public:
+  typedef T value_type;
+  typedef std::true_type propagate_on_container_move_assignment;
+  typedef std::true_type propagate_on_container_swap;
+
+  ResourceAllocator() : resource_(GetCurrentMemoryResource()) {}
+  explicit ResourceAllocator(MemoryResource *resource) : resource_(resource) {}
+  template <typename U>
+  ResourceAllocator(const ResourceAllocator<U> &other)
+      : resource_(other.resource()) {}
+
+  T *allocate(size_t n) {
+    return static_cast<T *>(resource_->Allocate(n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T *ptr, size_t n) {
+    resource_->Deallocate(ptr, n * sizeof(T), alignof(T));
+  }
+
+  ResourceAllocator select_on_container_copy_construction() const {
+    return ResourceAllocator();
+  }
+
+  MemoryResource *resource() const { return resource_; }
+
+ private:
+  MemoryResource *resource_;
+};
+
+template <typename T, typename U>
+bool operator==(const ResourceAllocator<T> &a, const ResourceAllocator<U> &b) {
+  return a.resource() == b.resource();
+}
+
+template <typename T, typename U>
+bool operator!=(const ResourceAllocator<T> &a, const ResourceAllocator<U> &b) {
+  return a.resource() != b.resource();
+}
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_MEMORY_RESOURCE_H_
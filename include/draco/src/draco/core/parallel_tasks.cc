@@ -0,0 +1,58 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/parallel_tasks.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace draco {
+
+bool RunParallelTasks(int num_tasks, int num_threads,
+                      const std::function<bool(int)> &task) {
+  num_threads = std::min(num_threads, num_tasks);
+  if (num_threads <= 1) {
+    for (int i = 0; i < num_tasks; ++i) {
+      if (!task(i)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::atomic<int> next_task(0);
+  std::atomic<bool> failed(false);
+  const auto worker = [&]() {
+    // Remaining tasks are skipped once any task failed.
+    for (int i = next_task++; i < num_tasks && !failed; i = next_task++) {
+      if (!task(i)) {
+        failed = true;
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (int i = 1; i < num_threads; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  return !failed;
+}
+
+}  // namespace draco
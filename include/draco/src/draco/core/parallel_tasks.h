@@ -0,0 +1,33 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_PARALLEL_TASKS_H_
+#define DRACO_CORE_PARALLEL_TASKS_H_
+
+#include <functional>
+
+namespace draco {
+
+// Calls |task| for every index in [0, |num_tasks|) using up to |num_threads|
+// threads, including the calling thread. Tasks are started in index order but
+// may run and finish in any order. Tasks running on the other threads use the
+// default memory resource rather than a scoped resource of the calling thread,
+// which is usually not thread safe. Returns false when any of the tasks
+// failed.
+bool RunParallelTasks(int num_tasks, int num_threads,
+                      const std::function<bool(int)> &task);
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_PARALLEL_TASKS_H_
@@ -73,6 +73,8 @@ class Dequantizer {
   }
   inline float operator()(int32_t val) const { return DequantizeFloat(val); }
 
+  float delta() const { return delta_; }
+
  private:
   float delta_;
 };
@@ -0,0 +1,129 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/trace.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace draco {
+
+namespace {
+
+struct Zone {
+  const char *name;
+  int64_t start_ns;
+  int64_t end_ns;
+};
+
+// Zones of one thread. The lock is only contended while a trace is exported
+// or restarted.
+struct ThreadZones {
+  std::mutex mutex;
+  uint32_t thread_id;
+  std::vector<Zone> zones;
+};
+
+std::mutex threads_mutex;
+// Never released, so threads can exit at any time.
+std::vector<std::unique_ptr<ThreadZones>> threads;
+thread_local ThreadZones *current_thread_zones = nullptr;
+std::atomic<int64_t> trace_start_ns(0);
+
+ThreadZones *GetThreadZones() {
+  if (current_thread_zones == nullptr) {
+    std::lock_guard<std::mutex> lock(threads_mutex);
+    threads.push_back(std::unique_ptr<ThreadZones>(new ThreadZones()));
+    threads.back()->thread_id = static_cast<uint32_t>(threads.size());
+    current_thread_zones = threads.back().get();
+  }
+  return current_thread_zones;
+}
+
+void AppendJsonString(const char *text, std::string *out) {
+  out->push_back('"');
+  for (const char *c = text; *c; ++c) {
+    if (*c == '"' || *c == '\\') {
+      out->push_back('\\');
+    }
+    if (static_cast<unsigned char>(*c) >= 0x20) {
+      out->push_back(*c);
+    }
+  }
+  out->push_back('"');
+}
+
+}  // namespace
+
+std::atomic<bool> Trace::recording_(false);
+
+void Trace::Start() {
+  {
+    std::lock_guard<std::mutex> lock(threads_mutex);
+    for (const auto &thread : threads) {
+      std::lock_guard<std::mutex> thread_lock(thread->mutex);
+      thread->zones.clear();
+    }
+  }
+  trace_start_ns.store(NowNs());
+  recording_.store(true);
+}
+
+void Trace::Stop() { recording_.store(false); }
+
+void Trace::AddZone(const char *name, int64_t start_ns, int64_t end_ns) {
+  if (!IsRecording()) {
+    return;
+  }
+  ThreadZones *const thread = GetThreadZones();
+  std::lock_guard<std::mutex> lock(thread->mutex);
+  thread->zones.push_back({name, start_ns, end_ns});
+}
+
+int64_t Trace::NowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+std::string Trace::ToChromeTraceJson() {
+  const int64_t origin_ns = trace_start_ns.load();
+  std::string json = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  bool first = true;
+  char event[160];
+  std::lock_guard<std::mutex> lock(threads_mutex);
+  for (const auto &thread : threads) {
+    std::lock_guard<std::mutex> thread_lock(thread->mutex);
+    for (const Zone &zone : thread->zones) {
+      json += first ? "{\"name\":" : ",\n{\"name\":";
+      first = false;
+      AppendJsonString(zone.name, &json);
+      // Timestamps are in microseconds, the fraction keeps nanoseconds.
+      snprintf(event, sizeof(event),
+               ",\"cat\":\"draco\",\"ph\":\"X\",\"pid\":1,\"tid\":%" PRIu32
+               ",\"ts\":%.3f,\"dur\":%.3f}",
+               thread->thread_id, (zone.start_ns - origin_ns) / 1000.0,
+               (zone.end_ns - zone.start_ns) / 1000.0);
+      json += event;
+    }
+  }
+  json += "]}\n";
+  return json;
+}
+
+}  // namespace draco
@@ -0,0 +1,88 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_TRACE_H_
+#define DRACO_CORE_TRACE_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <string>
+
+#include "draco/core/macros.h"
+
+namespace draco {
+
+// Collects timed zones from all threads while a trace is being recorded. The
+// zones are placed with DRACO_TRACE_ZONE, which only compiles to anything when
+// DRACO_TRACE_SUPPORTED is defined. Otherwise the library is unchanged and
+// the trace stays empty.
+class Trace {
+ public:
+  // Discards the zones of the previous trace and starts recording.
+  static void Start();
+  // Stops recording. The zones are kept until the next Start().
+  static void Stop();
+  static bool IsRecording() {
+    return recording_.load(std::memory_order_relaxed);
+  }
+
+  // Returns the recorded zones as Chrome trace events, which can be opened in
+  // chrome://tracing or ui.perfetto.dev. Every thread that recorded zones gets
+  // its own track.
+  static std::string ToChromeTraceJson();
+
+  // Records a zone of the calling thread. |name| must outlive the trace, in
+  // practice it's a string literal.
+  static void AddZone(const char *name, int64_t start_ns, int64_t end_ns);
+
+  // Monotonic time used for the zones.
+  static int64_t NowNs();
+
+ private:
+  static std::atomic<bool> recording_;
+};
+
+// Records its lifetime as a zone of the calling thread when a trace is being
+// recorded.
+class TraceZone {
+ public:
+  explicit TraceZone(const char *name)
+      : name_(Trace::IsRecording() ? name : nullptr),
+        start_ns_(name_ ? Trace::NowNs() : 0) {}
+  ~TraceZone() {
+    if (name_) {
+      Trace::AddZone(name_, start_ns_, Trace::NowNs());
+    }
+  }
+
+ private:
+  const char *const name_;
+  const int64_t start_ns_;
+  DISALLOW_COPY_AND_ASSIGN(TraceZone)
+};
+
+}  // namespace draco
+
+#ifdef DRACO_TRACE_SUPPORTED
+#define DRACO_TRACE_CONCAT_(a, b) a##b
+#define DRACO_TRACE_CONCAT(a, b) DRACO_TRACE_CONCAT_(a, b)
+// Records the rest of the enclosing scope as a zone named |name|.
+#define DRACO_TRACE_ZONE(name) \
+  const draco::TraceZone DRACO_TRACE_CONCAT(trace_zone_, __LINE__)(name)
+#else
+#define DRACO_TRACE_ZONE(name)
+#endif
+
+#endif  // DRACO_CORE_TRACE_H_
@@ -0,0 +1,721 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/vector_kernels.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "draco/core/bit_utils.h"
+
+#if defined(DRACO_X86_SIMD_SUPPORTED)
+#include <immintrin.h>
+#elif defined(DRACO_NEON_SUPPORTED)
+#include <arm_neon.h>
+#endif
+
+// Keeps the compiler from fusing multiplies and adds into FMA instructions,
+// which round once instead of twice. The float kernels would otherwise return
+// different values depending on the instruction set and the build flags (GCC
+// fuses by default on AArch64 and in AVX-512 code), so every float kernel,
+// including the scalar reference, uses it.
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#define DRACO_NO_FP_CONTRACT
+#elif defined(__GNUC__)
+#define DRACO_NO_FP_CONTRACT __attribute__((optimize("fp-contract=off")))
+#else
+#define DRACO_NO_FP_CONTRACT
+#endif
+
+// Compiles a function for the instruction set |isa| regardless of the flags
+// of the build.
+#if defined(__clang__) || defined(__GNUC__)
+#define DRACO_TARGET(isa) __attribute__((target(isa))) DRACO_NO_FP_CONTRACT
+#else
+#define DRACO_TARGET(isa)
+#endif
+
+namespace draco {
+
+namespace {
+
+// Scalar reference kernels.
+
+DRACO_NO_FP_CONTRACT
+void DequantizeFloatsScalar(const int32_t *in, int num_values,
+                            int num_components, const float *min_values,
+                            float delta, float *out) {
+  int c = 0;
+  for (int i = 0; i < num_values; ++i) {
+    const float value = static_cast<float>(in[i]) * delta;
+    out[i] = value + min_values[c];
+    if (++c == num_components) {
+      c = 0;
+    }
+  }
+}
+
+// Same as OctahedronToolBox::QuantizedOctahedralCoordsToUnitVector().
+DRACO_NO_FP_CONTRACT
+inline void OctahedralToUnitVector(int32_t s, int32_t t, float scale,
+                                   float *out) {
+  float y = s * scale - 1.f;
+  float z = t * scale - 1.f;
+  const float x = 1.f - std::abs(y) - std::abs(z);
+  float x_offset = -x;
+  x_offset = x_offset < 0 ? 0 : x_offset;
+  y += y < 0 ? x_offset : -x_offset;
+  z += z < 0 ? x_offset : -x_offset;
+  const float norm_squared = x * x + y * y + z * z;
+  if (norm_squared < 1e-6) {
+    out[0] = 0;
+    out[1] = 0;
+    out[2] = 0;
+  } else {
+    const float d = 1.0f / std::sqrt(norm_squared);
+    out[0] = x * d;
+    out[1] = y * d;
+    out[2] = z * d;
+  }
+}
+
+DRACO_NO_FP_CONTRACT
+void OctahedralToUnitVectorsScalar(const int32_t *in, int num_points,
+                                   float scale, float *out) {
+  for (int i = 0; i < num_points; ++i) {
+    OctahedralToUnitVector(in[2 * i], in[2 * i + 1], scale, out + 3 * i);
+  }
+}
+
+void GatherFloatsScalar(const float *in, const uint32_t *indices,
+                        int num_entries, int num_components, float *out) {
+  for (int i = 0; i < num_entries; ++i) {
+    std::memcpy(out + i * num_components,
+                in + static_cast<size_t>(indices[i]) * num_components,
+                sizeof(float) * num_components);
+  }
+}
+
+void WidenUint16Scalar(const uint16_t *in, int num_values, uint32_t *out) {
+  for (int i = 0; i < num_values; ++i) {
+    out[i] = in[i];
+  }
+}
+
+void SymbolsToSignedIntsScalar(const uint32_t *in, int num_values,
+                               int32_t *out) {
+  for (int i = 0; i < num_values; ++i) {
+    out[i] = ConvertSymbolToSignedInt(in[i]);
+  }
+}
+
+#if defined(DRACO_X86_SIMD_SUPPORTED) || defined(DRACO_NEON_SUPPORTED)
+
+// The scalar octahedral kernel compares the squared norm to the double 1e-6.
+// Returns the largest float below it, so that the vector kernels can do the
+// same test in single precision with <=.
+float OctahedralNormThreshold() {
+  float threshold = static_cast<float>(1e-6);
+  while (static_cast<double>(threshold) >= 1e-6) {
+    threshold = std::nextafter(threshold, 0.f);
+  }
+  return threshold;
+}
+
+// Repeats |min_values| over |num_lanes| * |num_components| floats, so that a
+// vector loaded at offset |num_lanes| * v holds the minimum values of the
+// components of the lanes of vector v in a block of |num_components| vectors.
+void FillComponentPattern(const float *min_values, int num_components,
+                          int num_lanes, float *pattern) {
+  for (int i = 0; i < num_lanes * num_components; ++i) {
+    pattern[i] = min_values[i % num_components];
+  }
+}
+
+#endif
+
+#if defined(DRACO_X86_SIMD_SUPPORTED)
+
+// Computes which entry and which component of a block of |num_lanes| entries
+// the lanes of each of the |num_components| output vectors of the block hold.
+void FillGatherLanes(int num_components, int num_lanes, int32_t *entries,
+                     int32_t *components) {
+  for (int i = 0; i < num_lanes * num_components; ++i) {
+    entries[i] = i / num_components;
+    components[i] = i % num_components;
+  }
+}
+
+// SSE4.1 kernels.
+
+DRACO_TARGET("sse4.1")
+void DequantizeFloatsSse41(const int32_t *in, int num_values,
+                           int num_components, const float *min_values,
+                           float delta, float *out) {
+  int i = 0;
+  if (num_components >= 1 && num_components <= 4) {
+    float pattern[4 * 4];
+    FillComponentPattern(min_values, num_components, 4, pattern);
+    __m128 min_vectors[4];
+    for (int v = 0; v < num_components; ++v) {
+      min_vectors[v] = _mm_loadu_ps(pattern + 4 * v);
+    }
+    const __m128 delta_vector = _mm_set1_ps(delta);
+    const int block_size = 4 * num_components;
+    for (; i + block_size <= num_values; i += block_size) {
+      for (int v = 0; v < num_components; ++v) {
+        const __m128 values = _mm_cvtepi32_ps(_mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(in + i + 4 * v)));
+        _mm_storeu_ps(out + i + 4 * v,
+                      _mm_add_ps(_mm_mul_ps(values, delta_vector),
+                                 min_vectors[v]));
+      }
+    }
+  }
+  DequantizeFloatsScalar(in + i, num_values - i, num_components, min_values,
+                         delta, out + i);
+}
+
+DRACO_TARGET("sse4.1")
+void OctahedralToUnitVectorsSse41(const int32_t *in, int num_points,
+                                  float scale, float *out) {
+  const __m128 scale_vector = _mm_set1_ps(scale);
+  const __m128 one = _mm_set1_ps(1.f);
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 sign = _mm_set1_ps(-0.f);
+  const __m128 threshold = _mm_set1_ps(OctahedralNormThreshold());
+  alignas(16) float xyz[3][4];
+  int i = 0;
+  for (; i + 4 <= num_points; i += 4) {
+    const __m128 st0 = _mm_sub_ps(
+        _mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128(
+                       reinterpret_cast<const __m128i *>(in + 2 * i))),
+                   scale_vector),
+        one);
+    const __m128 st1 = _mm_sub_ps(
+        _mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128(
+                       reinterpret_cast<const __m128i *>(in + 2 * i + 4))),
+                   scale_vector),
+        one);
+    __m128 y = _mm_shuffle_ps(st0, st1, _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 z = _mm_shuffle_ps(st0, st1, _MM_SHUFFLE(3, 1, 3, 1));
+    __m128 x = _mm_sub_ps(_mm_sub_ps(one, _mm_andnot_ps(sign, y)),
+                          _mm_andnot_ps(sign, z));
+    __m128 x_offset = _mm_xor_ps(x, sign);
+    x_offset = _mm_blendv_ps(x_offset, zero, _mm_cmplt_ps(x_offset, zero));
+    const __m128 neg_x_offset = _mm_xor_ps(x_offset, sign);
+    y = _mm_add_ps(
+        y, _mm_blendv_ps(neg_x_offset, x_offset, _mm_cmplt_ps(y, zero)));
+    z = _mm_add_ps(
+        z, _mm_blendv_ps(neg_x_offset, x_offset, _mm_cmplt_ps(z, zero)));
+    const __m128 norm_squared = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+    const __m128 d = _mm_div_ps(one, _mm_sqrt_ps(norm_squared));
+    const __m128 is_zero = _mm_cmple_ps(norm_squared, threshold);
+    _mm_store_ps(xyz[0], _mm_andnot_ps(is_zero, _mm_mul_ps(x, d)));
+    _mm_store_ps(xyz[1], _mm_andnot_ps(is_zero, _mm_mul_ps(y, d)));
+    _mm_store_ps(xyz[2], _mm_andnot_ps(is_zero, _mm_mul_ps(z, d)));
+    for (int k = 0; k < 4; ++k) {
+      out[3 * (i + k) + 0] = xyz[0][k];
+      out[3 * (i + k) + 1] = xyz[1][k];
+      out[3 * (i + k) + 2] = xyz[2][k];
+    }
+  }
+  OctahedralToUnitVectorsScalar(in + 2 * i, num_points - i, scale,
+                                out + 3 * i);
+}
+
+DRACO_TARGET("sse4.1")
+void WidenUint16Sse41(const uint16_t *in, int num_values, uint32_t *out) {
+  int i = 0;
+  for (; i + 8 <= num_values; i += 8) {
+    const __m128i values =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i),
+                     _mm_cvtepu16_epi32(values));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i + 4),
+                     _mm_cvtepu16_epi32(_mm_srli_si128(values, 8)));
+  }
+  WidenUint16Scalar(in + i, num_values - i, out + i);
+}
+
+DRACO_TARGET("sse4.1")
+void SymbolsToSignedIntsSse41(const uint32_t *in, int num_values,
+                              int32_t *out) {
+  const __m128i one = _mm_set1_epi32(1);
+  const __m128i zero = _mm_setzero_si128();
+  int i = 0;
+  for (; i + 4 <= num_values; i += 4) {
+    const __m128i symbols =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+    // (symbol >> 1) ^ -(symbol & 1).
+    const __m128i sign = _mm_sub_epi32(zero, _mm_and_si128(symbols, one));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i),
+                     _mm_xor_si128(_mm_srli_epi32(symbols, 1), sign));
+  }
+  SymbolsToSignedIntsScalar(in + i, num_values - i, out + i);
+}
+
+// AVX2 kernels.
+
+DRACO_TARGET("avx2")
+void DequantizeFloatsAvx2(const int32_t *in, int num_values,
+                          int num_components, const float *min_values,
+                          float delta, float *out) {
+  int i = 0;
+  if (num_components >= 1 && num_components <= 4) {
+    float pattern[8 * 4];
+    FillComponentPattern(min_values, num_components, 8, pattern);
+    __m256 min_vectors[4];
+    for (int v = 0; v < num_components; ++v) {
+      min_vectors[v] = _mm256_loadu_ps(pattern + 8 * v);
+    }
+    const __m256 delta_vector = _mm256_set1_ps(delta);
+    const int block_size = 8 * num_components;
+    for (; i + block_size <= num_values; i += block_size) {
+      for (int v = 0; v < num_components; ++v) {
+        const __m256 values = _mm256_cvtepi32_ps(_mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(in + i + 8 * v)));
+        _mm256_storeu_ps(out + i + 8 * v,
+                         _mm256_add_ps(_mm256_mul_ps(values, delta_vector),
+                                       min_vectors[v]));
+      }
+    }
+  }
+  DequantizeFloatsScalar(in + i, num_values - i, num_components, min_values,
+                         delta, out + i);
+}
+
+DRACO_TARGET("avx2")
+void OctahedralToUnitVectorsAvx2(const int32_t *in, int num_points,
+                                 float scale, float *out) {
+  const __m256 scale_vector = _mm256_set1_ps(scale);
+  const __m256 one = _mm256_set1_ps(1.f);
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256 sign = _mm256_set1_ps(-0.f);
+  const __m256 threshold = _mm256_set1_ps(OctahedralNormThreshold());
+  alignas(32) float xyz[3][8];
+  int i = 0;
+  for (; i + 8 <= num_points; i += 8) {
+    const __m256 st0 = _mm256_sub_ps(
+        _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_loadu_si256(
+                          reinterpret_cast<const __m256i *>(in + 2 * i))),
+                      scale_vector),
+        one);
+    const __m256 st1 = _mm256_sub_ps(
+        _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_loadu_si256(
+                          reinterpret_cast<const __m256i *>(in + 2 * i + 8))),
+                      scale_vector),
+        one);
+    // The shuffles work within 128-bit lanes, the permutes restore the order
+    // of the points.
+    __m256 y = _mm256_castpd_ps(_mm256_permute4x64_pd(
+        _mm256_castps_pd(_mm256_shuffle_ps(st0, st1, _MM_SHUFFLE(2, 0, 2, 0))),
+        _MM_SHUFFLE(3, 1, 2, 0)));
+    __m256 z = _mm256_castpd_ps(_mm256_permute4x64_pd(
+        _mm256_castps_pd(_mm256_shuffle_ps(st0, st1, _MM_SHUFFLE(3, 1, 3, 1))),
+        _MM_SHUFFLE(3, 1, 2, 0)));
+    __m256 x = _mm256_sub_ps(_mm256_sub_ps(one, _mm256_andnot_ps(sign, y)),
+                             _mm256_andnot_ps(sign, z));
+    __m256 x_offset = _mm256_xor_ps(x, sign);
+    x_offset = _mm256_blendv_ps(x_offset, zero,
+                                _mm256_cmp_ps(x_offset, zero, _CMP_LT_OQ));
+    const __m256 neg_x_offset = _mm256_xor_ps(x_offset, sign);
+    y = _mm256_add_ps(y, _mm256_blendv_ps(neg_x_offset, x_offset,
+                                          _mm256_cmp_ps(y, zero, _CMP_LT_OQ)));
+    z = _mm256_add_ps(z, _mm256_blendv_ps(neg_x_offset, x_offset,
+                                          _mm256_cmp_ps(z, zero, _CMP_LT_OQ)));
+    const __m256 norm_squared =
+        _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)),
+                      _mm256_mul_ps(z, z));
+    const __m256 d = _mm256_div_ps(one, _mm256_sqrt_ps(norm_squared));
+    const __m256 is_zero = _mm256_cmp_ps(norm_squared, threshold, _CMP_LE_OQ);
+    _mm256_store_ps(xyz[0], _mm256_andnot_ps(is_zero, _mm256_mul_ps(x, d)));
+    _mm256_store_ps(xyz[1], _mm256_andnot_ps(is_zero, _mm256_mul_ps(y, d)));
+    _mm256_store_ps(xyz[2], _mm256_andnot_ps(is_zero, _mm256_mul_ps(z, d)));
+    for (int k = 0; k < 8; ++k) {
+      out[3 * (i + k) + 0] = xyz[0][k];
+      out[3 * (i + k) + 1] = xyz[1][k];
+      out[3 * (i + k) + 2] = xyz[2][k];
+    }
+  }
+  OctahedralToUnitVectorsScalar(in + 2 * i, num_points - i, scale,
+                                out + 3 * i);
+}
+
+DRACO_TARGET("avx2")
+void GatherFloatsAvx2(const float *in, const uint32_t *indices,
+                      int num_entries, int num_components, float *out) {
+  int i = 0;
+  if (num_components >= 1 && num_components <= 4) {
+    int32_t entries[8 * 4];
+    int32_t components[8 * 4];
+    FillGatherLanes(num_components, 8, entries, components);
+    __m256i entry_lanes[4];
+    __m256i component_lanes[4];
+    for (int v = 0; v < num_components; ++v) {
+      entry_lanes[v] = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i *>(entries + 8 * v));
+      component_lanes[v] = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i *>(components + 8 * v));
+    }
+    const __m256i stride = _mm256_set1_epi32(num_components);
+    for (; i + 8 <= num_entries; i += 8) {
+      const __m256i block =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+      float *const block_out = out + i * num_components;
+      for (int v = 0; v < num_components; ++v) {
+        const __m256i entry_indices =
+            _mm256_permutevar8x32_epi32(block, entry_lanes[v]);
+        const __m256i offsets = _mm256_add_epi32(
+            _mm256_mullo_epi32(entry_indices, stride), component_lanes[v]);
+        _mm256_storeu_ps(block_out + 8 * v,
+                         _mm256_i32gather_ps(in, offsets, sizeof(float)));
+      }
+    }
+  }
+  GatherFloatsScalar(in, indices + i, num_entries - i, num_components,
+                     out + i * num_components);
+}
+
+DRACO_TARGET("avx2")
+void WidenUint16Avx2(const uint16_t *in, int num_values, uint32_t *out) {
+  int i = 0;
+  for (; i + 8 <= num_values; i += 8) {
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i *>(out + i),
+        _mm256_cvtepu16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i))));
+  }
+  WidenUint16Scalar(in + i, num_values - i, out + i);
+}
+
+DRACO_TARGET("avx2")
+void SymbolsToSignedIntsAvx2(const uint32_t *in, int num_values,
+                             int32_t *out) {
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i zero = _mm256_setzero_si256();
+  int i = 0;
+  for (; i + 8 <= num_values; i += 8) {
+    const __m256i symbols =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+    const __m256i sign = _mm256_sub_epi32(zero, _mm256_and_si256(symbols, one));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i),
+                        _mm256_xor_si256(_mm256_srli_epi32(symbols, 1), sign));
+  }
+  SymbolsToSignedIntsScalar(in + i, num_values - i, out + i);
+}
+
+// AVX-512 kernels. Only AVX-512 Foundation instructions are used.
+
+#if defined(__GNUC__) && !defined(__clang__)
+// The AVX-512 headers of GCC 12 trigger false positives of this warning.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+DRACO_TARGET("avx512f")
+void DequantizeFloatsAvx512(const int32_t *in, int num_values,
+                            int num_components, const float *min_values,
+                            float delta, float *out) {
+  int i = 0;
+  if (num_components >= 1 && num_components <= 4) {
+    float pattern[16 * 4];
+    FillComponentPattern(min_values, num_components, 16, pattern);
+    __m512 min_vectors[4];
+    for (int v = 0; v < num_components; ++v) {
+      min_vectors[v] = _mm512_loadu_ps(pattern + 16 * v);
+    }
+    const __m512 delta_vector = _mm512_set1_ps(delta);
+    const int block_size = 16 * num_components;
+    for (; i + block_size <= num_values; i += block_size) {
+      for (int v = 0; v < num_components; ++v) {
+        const __m512 values =
+            _mm512_cvtepi32_ps(_mm512_loadu_si512(in + i + 16 * v));
+        _mm512_storeu_ps(out + i + 16 * v,
+                         _mm512_add_ps(_mm512_mul_ps(values, delta_vector),
+                                       min_vectors[v]));
+      }
+    }
+  }
+  DequantizeFloatsScalar(in + i, num_values - i, num_components, min_values,
+                         delta, out + i);
+}
+
+DRACO_TARGET("avx512f")
+void OctahedralToUnitVectorsAvx512(const int32_t *in, int num_points,
+                                   float scale, float *out) {
+  const __m512 scale_vector = _mm512_set1_ps(scale);
+  const __m512 one = _mm512_set1_ps(1.f);
+  const __m512 zero = _mm512_setzero_ps();
+  const __m512i sign = _mm512_set1_epi32(INT32_MIN);
+  const __m512 threshold = _mm512_set1_ps(OctahedralNormThreshold());
+  const __m512i even_lanes = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16,
+                                               18, 20, 22, 24, 26, 28, 30);
+  const __m512i odd_lanes = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17,
+                                              19, 21, 23, 25, 27, 29, 31);
+  alignas(64) float xyz[3][16];
+  int i = 0;
+  for (; i + 16 <= num_points; i += 16) {
+    const __m512 st0 = _mm512_sub_ps(
+        _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_loadu_si512(in + 2 * i)),
+                      scale_vector),
+        one);
+    const __m512 st1 = _mm512_sub_ps(
+        _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_loadu_si512(in + 2 * i + 16)),
+                      scale_vector),
+        one);
+    __m512 y = _mm512_permutex2var_ps(st0, even_lanes, st1);
+    __m512 z = _mm512_permutex2var_ps(st0, odd_lanes, st1);
+    __m512 x = _mm512_sub_ps(_mm512_sub_ps(one, _mm512_abs_ps(y)),
+                             _mm512_abs_ps(z));
+    __m512 x_offset =
+        _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(x), sign));
+    x_offset = _mm512_mask_blend_ps(
+        _mm512_cmp_ps_mask(x_offset, zero, _CMP_LT_OQ), x_offset, zero);
+    const __m512 neg_x_offset = _mm512_castsi512_ps(
+        _mm512_xor_si512(_mm512_castps_si512(x_offset), sign));
+    y = _mm512_add_ps(
+        y, _mm512_mask_blend_ps(_mm512_cmp_ps_mask(y, zero, _CMP_LT_OQ),
+                                neg_x_offset, x_offset));
+    z = _mm512_add_ps(
+        z, _mm512_mask_blend_ps(_mm512_cmp_ps_mask(z, zero, _CMP_LT_OQ),
+                                neg_x_offset, x_offset));
+    const __m512 norm_squared =
+        _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(x, x), _mm512_mul_ps(y, y)),
+                      _mm512_mul_ps(z, z));
+    const __m512 d = _mm512_div_ps(one, _mm512_sqrt_ps(norm_squared));
+    const __mmask16 is_nonzero =
+        _mm512_cmp_ps_mask(norm_squared, threshold, _CMP_GT_OQ);
+    _mm512_store_ps(xyz[0], _mm512_maskz_mul_ps(is_nonzero, x, d));
+    _mm512_store_ps(xyz[1], _mm512_maskz_mul_ps(is_nonzero, y, d));
+    _mm512_store_ps(xyz[2], _mm512_maskz_mul_ps(is_nonzero, z, d));
+    for (int k = 0; k < 16; ++k) {
+      out[3 * (i + k) + 0] = xyz[0][k];
+      out[3 * (i + k) + 1] = xyz[1][k];
+      out[3 * (i + k) + 2] = xyz[2][k];
+    }
+  }
+  OctahedralToUnitVectorsScalar(in + 2 * i, num_points - i, scale,
+                                out + 3 * i);
+}
+
+DRACO_TARGET("avx512f")
+void GatherFloatsAvx512(const float *in, const uint32_t *indices,
+                        int num_entries, int num_components, float *out) {
+  int i = 0;
+  if (num_components >= 1 && num_components <= 4) {
+    int32_t entries[16 * 4];
+    int32_t components[16 * 4];
+    FillGatherLanes(num_components, 16, entries, components);
+    __m512i entry_lanes[4];
+    __m512i component_lanes[4];
+    for (int v = 0; v < num_components; ++v) {
+      entry_lanes[v] = _mm512_loadu_si512(entries + 16 * v);
+      component_lanes[v] = _mm512_loadu_si512(components + 16 * v);
+    }
+    const __m512i stride = _mm512_set1_epi32(num_components);
+    for (; i + 16 <= num_entries; i += 16) {
+      const __m512i block = _mm512_loadu_si512(indices + i);
+      float *const block_out = out + i * num_components;
+      for (int v = 0; v < num_components; ++v) {
+        const __m512i entry_indices =
+            _mm512_permutexvar_epi32(entry_lanes[v], block);
+        const __m512i offsets = _mm512_add_epi32(
+            _mm512_mullo_epi32(entry_indices, stride), component_lanes[v]);
+        _mm512_storeu_ps(block_out + 16 * v,
+                         _mm512_i32gather_ps(offsets, in, sizeof(float)));
+      }
+    }
+  }
+  GatherFloatsScalar(in, indices + i, num_entries - i, num_components,
+                     out + i * num_components);
+}
+
+DRACO_TARGET("avx512f")
+void WidenUint16Avx512(const uint16_t *in, int num_values, uint32_t *out) {
+  int i = 0;
+  for (; i + 16 <= num_values; i += 16) {
+    _mm512_storeu_si512(
+        out + i, _mm512_cvtepu16_epi32(_mm256_loadu_si256(
+                     reinterpret_cast<const __m256i *>(in + i))));
+  }
+  WidenUint16Scalar(in + i, num_values - i, out + i);
+}
+
+DRACO_TARGET("avx512f")
+void SymbolsToSignedIntsAvx512(const uint32_t *in, int num_values,
+                               int32_t *out) {
+  const __m512i one = _mm512_set1_epi32(1);
+  const __m512i zero = _mm512_setzero_si512();
+  int i = 0;
+  for (; i + 16 <= num_values; i += 16) {
+    const __m512i symbols = _mm512_loadu_si512(in + i);
+    const __m512i sign = _mm512_sub_epi32(zero, _mm512_and_si512(symbols, one));
+    _mm512_storeu_si512(out + i,
+                        _mm512_xor_si512(_mm512_srli_epi32(symbols, 1), sign));
+  }
+  SymbolsToSignedIntsScalar(in + i, num_values - i, out + i);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+const VectorKernels kSse41Kernels = {
+    CPU_LEVEL_SSE4_1, DequantizeFloatsSse41, OctahedralToUnitVectorsSse41,
+    GatherFloatsScalar, WidenUint16Sse41, SymbolsToSignedIntsSse41};
+
+const VectorKernels kAvx2Kernels = {
+    CPU_LEVEL_AVX2, DequantizeFloatsAvx2, OctahedralToUnitVectorsAvx2,
+    GatherFloatsAvx2, WidenUint16Avx2, SymbolsToSignedIntsAvx2};
+
+const VectorKernels kAvx512Kernels = {
+    CPU_LEVEL_AVX512, DequantizeFloatsAvx512, OctahedralToUnitVectorsAvx512,
+    GatherFloatsAvx512, WidenUint16Avx512, SymbolsToSignedIntsAvx512};
+
+#endif  // DRACO_X86_SIMD_SUPPORTED
+
+#if defined(DRACO_NEON_SUPPORTED)
+
+// NEON kernels. NEON has no gather instruction, the scalar gather is used.
+
+DRACO_NO_FP_CONTRACT
+void DequantizeFloatsNeon(const int32_t *in, int num_values,
+                          int num_components, const float *min_values,
+                          float delta, float *out) {
+  int i = 0;
+  if (num_components >= 1 && num_components <= 4) {
+    float pattern[4 * 4];
+    FillComponentPattern(min_values, num_components, 4, pattern);
+    float32x4_t min_vectors[4];
+    for (int v = 0; v < num_components; ++v) {
+      min_vectors[v] = vld1q_f32(pattern + 4 * v);
+    }
+    const float32x4_t delta_vector = vdupq_n_f32(delta);
+    const int block_size = 4 * num_components;
+    for (; i + block_size <= num_values; i += block_size) {
+      for (int v = 0; v < num_components; ++v) {
+        const float32x4_t values = vcvtq_f32_s32(vld1q_s32(in + i + 4 * v));
+        vst1q_f32(out + i + 4 * v,
+                  vaddq_f32(vmulq_f32(values, delta_vector), min_vectors[v]));
+      }
+    }
+  }
+  DequantizeFloatsScalar(in + i, num_values - i, num_components, min_values,
+                         delta, out + i);
+}
+
+DRACO_NO_FP_CONTRACT
+void OctahedralToUnitVectorsNeon(const int32_t *in, int num_points,
+                                 float scale, float *out) {
+  const float32x4_t scale_vector = vdupq_n_f32(scale);
+  const float32x4_t one = vdupq_n_f32(1.f);
+  const float32x4_t zero = vdupq_n_f32(0.f);
+  const float32x4_t threshold = vdupq_n_f32(OctahedralNormThreshold());
+  int i = 0;
+  for (; i + 4 <= num_points; i += 4) {
+    const int32x4x2_t st = vld2q_s32(in + 2 * i);
+    float32x4_t y =
+        vsubq_f32(vmulq_f32(vcvtq_f32_s32(st.val[0]), scale_vector), one);
+    float32x4_t z =
+        vsubq_f32(vmulq_f32(vcvtq_f32_s32(st.val[1]), scale_vector), one);
+    const float32x4_t x = vsubq_f32(vsubq_f32(one, vabsq_f32(y)), vabsq_f32(z));
+    float32x4_t x_offset = vnegq_f32(x);
+    x_offset = vbslq_f32(vcltq_f32(x_offset, zero), zero, x_offset);
+    const float32x4_t neg_x_offset = vnegq_f32(x_offset);
+    y = vaddq_f32(y, vbslq_f32(vcltq_f32(y, zero), x_offset, neg_x_offset));
+    z = vaddq_f32(z, vbslq_f32(vcltq_f32(z, zero), x_offset, neg_x_offset));
+    const float32x4_t norm_squared =
+        vaddq_f32(vaddq_f32(vmulq_f32(x, x), vmulq_f32(y, y)), vmulq_f32(z, z));
+    const float32x4_t d = vdivq_f32(one, vsqrtq_f32(norm_squared));
+    const uint32x4_t is_zero = vcleq_f32(norm_squared, threshold);
+    float32x4x3_t xyz;
+    xyz.val[0] = vbslq_f32(is_zero, zero, vmulq_f32(x, d));
+    xyz.val[1] = vbslq_f32(is_zero, zero, vmulq_f32(y, d));
+    xyz.val[2] = vbslq_f32(is_zero, zero, vmulq_f32(z, d));
+    vst3q_f32(out + 3 * i, xyz);
+  }
+  OctahedralToUnitVectorsScalar(in + 2 * i, num_points - i, scale,
+                                out + 3 * i);
+}
+
+void WidenUint16Neon(const uint16_t *in, int num_values, uint32_t *out) {
+  int i = 0;
+  for (; i + 8 <= num_values; i += 8) {
+    const uint16x8_t values = vld1q_u16(in + i);
+    vst1q_u32(out + i, vmovl_u16(vget_low_u16(values)));
+    vst1q_u32(out + i + 4, vmovl_u16(vget_high_u16(values)));
+  }
+  WidenUint16Scalar(in + i, num_values - i, out + i);
+}
+
+void SymbolsToSignedIntsNeon(const uint32_t *in, int num_values,
+                             int32_t *out) {
+  const uint32x4_t one = vdupq_n_u32(1);
+  int i = 0;
+  for (; i + 4 <= num_values; i += 4) {
+    const uint32x4_t symbols = vld1q_u32(in + i);
+    const int32x4_t sign =
+        vnegq_s32(vreinterpretq_s32_u32(vandq_u32(symbols, one)));
+    vst1q_s32(out + i,
+              veorq_s32(vreinterpretq_s32_u32(vshrq_n_u32(symbols, 1)), sign));
+  }
+  SymbolsToSignedIntsScalar(in + i, num_values - i, out + i);
+}
+
+const VectorKernels kNeonKernels = {
+    CPU_LEVEL_NEON, DequantizeFloatsNeon, OctahedralToUnitVectorsNeon,
+    GatherFloatsScalar, WidenUint16Neon, SymbolsToSignedIntsNeon};
+
+#endif  // DRACO_NEON_SUPPORTED
+
+const VectorKernels kScalarKernels = {
+    CPU_LEVEL_SCALAR, DequantizeFloatsScalar, OctahedralToUnitVectorsScalar,
+    GatherFloatsScalar, WidenUint16Scalar, SymbolsToSignedIntsScalar};
+
+}  // namespace
+
+const VectorKernels &GetVectorKernels() {
+  static const VectorKernels *const kernels =
+      GetVectorKernels(GetBestCpuLevel());
+  return *kernels;
+}
+
+const VectorKernels *GetVectorKernels(CpuLevel level) {
+  if (!IsCpuLevelSupported(level)) {
+    return nullptr;
+  }
+  switch (level) {
+    case CPU_LEVEL_SCALAR:
+      return &kScalarKernels;
+#if defined(DRACO_X86_SIMD_SUPPORTED)
+    case CPU_LEVEL_SSE4_1:
+      return &kSse41Kernels;
+    case CPU_LEVEL_AVX2:
+      return &kAvx2Kernels;
+    case CPU_LEVEL_AVX512:
+      return &kAvx512Kernels;
+#endif
+#if defined(DRACO_NEON_SUPPORTED)
+    case CPU_LEVEL_NEON:
+      return &kNeonKernels;
+#endif
+    default:
+      return nullptr;
+  }
+}
+
+}  // namespace draco
@@ -0,0 +1,70 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_VECTOR_KERNELS_H_
+#define DRACO_CORE_VECTOR_KERNELS_H_
+
+#include <stdint.h>
+
+#include "draco/core/cpu_features.h"
+
+namespace draco {
+
+// Hot loops of the decoder with one implementation per instruction set. The
+// best implementation supported by the CPU is selected at run time, so the
+// library can be built for the baseline architecture. Every implementation
+// returns bit-identical values to the scalar one, which is the reference.
+// Unless noted otherwise, |in| and |out| may point to the same array.
+struct VectorKernels {
+  CpuLevel level;
+
+  // out[i] = in[i] * delta + min_values[i % num_components]. Used to undo the
+  // quantization of attribute values. |in| and |out| must not overlap.
+  void (*dequantize_floats)(const int32_t *in, int num_values,
+                            int num_components, const float *min_values,
+                            float delta, float *out);
+
+  // Decodes |num_points| pairs of quantized octahedral coordinates (s, t) to
+  // unit vectors with three components, see OctahedronToolBox. |scale| maps
+  // the coordinates to <0, 2>. |in| and |out| must not overlap.
+  void (*octahedral_to_unit_vectors)(const int32_t *in, int num_points,
+                                     float scale, float *out);
+
+  // Copies the |num_components| floats of entry |indices[i]| of |in| to entry
+  // i of |out|, for |num_entries| entries. Used to expand attribute values to
+  // points. |in| must have less than 2^31 values and must not overlap |out|.
+  void (*gather_floats)(const float *in, const uint32_t *indices,
+                        int num_entries, int num_components, float *out);
+
+  // Zero extends 16-bit indices to 32 bits. |in| and |out| must not overlap.
+  void (*widen_uint16)(const uint16_t *in, int num_values, uint32_t *out);
+
+  // Converts the symbols of entropy coded prediction corrections back to
+  // signed integers, see ConvertSymbolToSignedInt().
+  void (*symbols_to_signed_ints)(const uint32_t *in, int num_values,
+                                 int32_t *out);
+};
+
+// Returns the kernels of the most capable supported instruction set. They
+// are selected on the first call.
+const VectorKernels &GetVectorKernels();
+
+// Returns the kernels of |level| or nullptr when |level| is not supported.
+// Levels without their own implementation of a kernel use the implementation
+// of the next lower level.
+const VectorKernels *GetVectorKernels(CpuLevel level);
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_VECTOR_KERNELS_H_
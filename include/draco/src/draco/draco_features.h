@@ -3,6 +3,9 @@
 
 #define DRACO_MESH_COMPRESSION_SUPPORTED
 #define DRACO_NORMAL_ENCODING_SUPPORTED
+#define DRACO_POINT_CLOUD_COMPRESSION_SUPPORTED
 #define DRACO_STANDARD_EDGEBREAKER_SUPPORTED
+#define DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
+#define DRACO_ATTRIBUTE_INDICES_DEDUPLICATION_SUPPORTED
 
 #endif  // DRACO_FEATURES_H_
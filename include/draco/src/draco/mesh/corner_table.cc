@@ -14,6 +14,7 @@
 //
 #include "draco/mesh/corner_table.h"
 
+#include <algorithm>
 #include <limits>
 
 #include "draco/attributes/geometry_indices.h"
@@ -95,116 +96,115 @@ bool CornerTable::ComputeOppositeCorners(int *num_vertices) {
   // half-edge to its source vertex.
 
   // First compute the number of outgoing half-edges (corners) attached to each
-  // vertex.
-  std::vector<int> num_corners_on_vertices;
-  num_corners_on_vertices.reserve(num_corners());
+  // vertex. For each corner there is always exactly one outgoing half-edge
+  // attached to its vertex.
+  int max_vertex = -1;
   for (CornerIndex c(0); c < num_corners(); ++c) {
-    const VertexIndex v1 = Vertex(c);
-    if (v1.value() >= static_cast<int>(num_corners_on_vertices.size())) {
-      num_corners_on_vertices.resize(v1.value() + 1, 0);
-    }
-    // For each corner there is always exactly one outgoing half-edge attached
-    // to its vertex.
-    num_corners_on_vertices[v1.value()]++;
+    max_vertex = std::max(max_vertex, static_cast<int>(Vertex(c).value()));
+  }
+  const int num_vertices_found = max_vertex + 1;
+  // The counts are stored one entry later and then turned into the offsets of
+  // the first half-edge of each vertex (location where the first half-edge
+  // entry of a given vertex is going to be stored). This way each vertex is
+  // guaranteed to have a non-overlapping storage with respect to the other
+  // vertices, and the storage of vertex |v| ends at |vertex_offset[v + 1]|.
+  std::vector<int> vertex_offset(num_vertices_found + 1, 0);
+  for (CornerIndex c(0); c < num_corners(); ++c) {
+    ++vertex_offset[Vertex(c).value() + 1];
+  }
+  for (int i = 0; i < num_vertices_found; ++i) {
+    vertex_offset[i + 1] += vertex_offset[i];
   }
 
   // Create a storage for half-edges on each vertex. We store all half-edges in
   // one array, where each entry is identified by the half-edge's sink vertex id
   // and the associated half-edge corner id (corner opposite to the half-edge).
-  // Each vertex will be assigned storage for up to
-  // |num_corners_on_vertices[vert_id]| half-edges. Unused half-edges are marked
-  // with |sink_vert| == kInvalidVertexIndex.
+  // The vertex of the corner is stored as well so that mirrored faces can be
+  // detected without looking up the corner. Unused half-edges are marked with
+  // |sink_vert| == kInvalidVertexIndex.
   struct VertexEdgePair {
     VertexEdgePair()
-        : sink_vert(kInvalidVertexIndex), edge_corner(kInvalidCornerIndex) {}
+        : sink_vert(kInvalidVertexIndex),
+          edge_corner(kInvalidCornerIndex),
+          tip_vert(kInvalidVertexIndex) {}
     VertexIndex sink_vert;
     CornerIndex edge_corner;
+    VertexIndex tip_vert;
   };
   std::vector<VertexEdgePair> vertex_edges(num_corners(), VertexEdgePair());
 
-  // For each vertex compute the offset (location where the first half-edge
-  // entry of a given vertex is going to be stored). This way each vertex is
-  // guaranteed to have a non-overlapping storage with respect to the other
-  // vertices.
-  std::vector<int> vertex_offset(num_corners_on_vertices.size());
-  int offset = 0;
-  for (size_t i = 0; i < num_corners_on_vertices.size(); ++i) {
-    vertex_offset[i] = offset;
-    offset += num_corners_on_vertices[i];
-  }
-
   // Now go over the all half-edges (using their opposite corners) and either
   // insert them to the |vertex_edge| array or connect them with existing
-  // half-edges.
-  for (CornerIndex c(0); c < num_corners(); ++c) {
-    const VertexIndex tip_v = Vertex(c);
-    const VertexIndex source_v = Vertex(Next(c));
-    const VertexIndex sink_v = Vertex(Previous(c));
-
-    const FaceIndex face_index = Face(c);
-    if (c == FirstCorner(face_index)) {
-      // Check whether the face is degenerated, if so ignore it.
-      const VertexIndex v0 = Vertex(c);
-      if (v0 == source_v || v0 == sink_v || source_v == sink_v) {
-        ++num_degenerated_faces_;
-        c += 2;  // Ignore the next two corners of the same face.
-        continue;
-      }
+  // half-edges. The faces are processed as a whole so that the vertices of
+  // all three corners are looked up only once.
+  for (FaceIndex f(0); f < num_faces(); ++f) {
+    const CornerIndex first_c = FirstCorner(f);
+    const VertexIndex face_verts[3] = {Vertex(first_c), Vertex(first_c + 1),
+                                       Vertex(first_c + 2)};
+    // Check whether the face is degenerated, if so ignore it.
+    if (face_verts[0] == face_verts[1] || face_verts[0] == face_verts[2] ||
+        face_verts[1] == face_verts[2]) {
+      ++num_degenerated_faces_;
+      continue;
     }
-
-    CornerIndex opposite_c(kInvalidCornerIndex);
-    // The maximum number of half-edges attached to the sink vertex.
-    const int num_corners_on_vert = num_corners_on_vertices[sink_v.value()];
-    // Where to look for the first half-edge on the sink vertex.
-    offset = vertex_offset[sink_v.value()];
-    for (int i = 0; i < num_corners_on_vert; ++i, ++offset) {
-      const VertexIndex other_v = vertex_edges[offset].sink_vert;
-      if (other_v == kInvalidVertexIndex) {
-        break;  // No matching half-edge found on the sink vertex.
-      }
-      if (other_v == source_v) {
-        if (tip_v == Vertex(vertex_edges[offset].edge_corner)) {
-          continue;  // Don't connect mirrored faces.
+    for (int k = 0; k < 3; ++k) {
+      const CornerIndex c = first_c + k;
+      const VertexIndex tip_v = face_verts[k];
+      const VertexIndex source_v = face_verts[k == 2 ? 0 : k + 1];
+      const VertexIndex sink_v = face_verts[k == 0 ? 2 : k - 1];
+
+      CornerIndex opposite_c(kInvalidCornerIndex);
+      // Look for the half-edge among the half-edges attached to the sink
+      // vertex.
+      const int sink_end = vertex_offset[sink_v.value() + 1];
+      for (int offset = vertex_offset[sink_v.value()]; offset < sink_end;
+           ++offset) {
+        const VertexIndex other_v = vertex_edges[offset].sink_vert;
+        if (other_v == kInvalidVertexIndex) {
+          break;  // No matching half-edge found on the sink vertex.
         }
-        // A matching half-edge was found on the sink vertex. Mark the
-        // half-edge's opposite corner.
-        opposite_c = vertex_edges[offset].edge_corner;
-        // Remove the half-edge from the sink vertex. We remap all subsequent
-        // half-edges one slot down.
-        // TODO(ostava): This can be optimized a little bit, by remapping only
-        // the half-edge on the last valid slot into the deleted half-edge's
-        // slot.
-        for (int j = i + 1; j < num_corners_on_vert; ++j, ++offset) {
-          vertex_edges[offset] = vertex_edges[offset + 1];
-          if (vertex_edges[offset].sink_vert == kInvalidVertexIndex) {
-            break;  // Unused half-edge reached.
+        if (other_v == source_v) {
+          if (tip_v == vertex_edges[offset].tip_vert) {
+            continue;  // Don't connect mirrored faces.
+          }
+          // A matching half-edge was found on the sink vertex. Mark the
+          // half-edge's opposite corner.
+          opposite_c = vertex_edges[offset].edge_corner;
+          // Remove the half-edge from the sink vertex. We remap all subsequent
+          // half-edges one slot down to keep the order in which half-edges of
+          // non-manifold edges are matched.
+          for (; offset + 1 < sink_end; ++offset) {
+            vertex_edges[offset] = vertex_edges[offset + 1];
+            if (vertex_edges[offset].sink_vert == kInvalidVertexIndex) {
+              break;  // Unused half-edge reached.
+            }
           }
+          // Mark the last entry as unused.
+          vertex_edges[offset].sink_vert = kInvalidVertexIndex;
+          break;
         }
-        // Mark the last entry as unused.
-        vertex_edges[offset].sink_vert = kInvalidVertexIndex;
-        break;
       }
-    }
-    if (opposite_c == kInvalidCornerIndex) {
-      // No opposite corner found. Insert the new edge
-      const int num_corners_on_source_vert =
-          num_corners_on_vertices[source_v.value()];
-      offset = vertex_offset[source_v.value()];
-      for (int i = 0; i < num_corners_on_source_vert; ++i, ++offset) {
-        // Find the first unused half-edge slot on the source vertex.
-        if (vertex_edges[offset].sink_vert == kInvalidVertexIndex) {
-          vertex_edges[offset].sink_vert = sink_v;
-          vertex_edges[offset].edge_corner = c;
-          break;
+      if (opposite_c == kInvalidCornerIndex) {
+        // No opposite corner found. Insert the new edge into the first unused
+        // half-edge slot on the source vertex.
+        const int source_end = vertex_offset[source_v.value() + 1];
+        for (int offset = vertex_offset[source_v.value()]; offset < source_end;
+             ++offset) {
+          if (vertex_edges[offset].sink_vert == kInvalidVertexIndex) {
+            vertex_edges[offset].sink_vert = sink_v;
+            vertex_edges[offset].edge_corner = c;
+            vertex_edges[offset].tip_vert = tip_v;
+            break;
+          }
         }
+      } else {
+        // Opposite corner found.
+        opposite_corners_[c] = opposite_c;
+        opposite_corners_[opposite_c] = c;
       }
-    } else {
-      // Opposite corner found.
-      opposite_corners_[c] = opposite_c;
-      opposite_corners_[opposite_c] = c;
     }
   }
-  *num_vertices = static_cast<int>(num_corners_on_vertices.size());
+  *num_vertices = num_vertices_found;
   return true;
 }
 
@@ -60,6 +60,10 @@ class Mesh : public PointCloud {
   // existing ones if necessary.
   void SetNumFaces(size_t num_faces) { faces_.resize(num_faces, Face()); }
 
+  // Returns the storage of all faces so that they can be written at once
+  // after SetNumFaces(). The pointer is invalidated when faces are added.
+  Face *face_data() { return faces_.data(); }
+
   FaceIndex::ValueType num_faces() const {
     return static_cast<uint32_t>(faces_.size());
   }
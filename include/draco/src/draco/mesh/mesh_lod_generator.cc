@@ -0,0 +1,508 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/mesh_lod_generator.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+
+#include "draco/core/trace.h"
+#include "draco/core/vector_d.h"
+#include "draco/mesh/corner_table.h"
+#include "draco/mesh/corner_table_iterators.h"
+#include "draco/mesh/mesh_misc_functions.h"
+
+namespace draco {
+
+namespace {
+
+// Levels that remove less than a quarter of the faces of the previous level
+// aren't worth switching to.
+constexpr float kMinLevelReduction = 0.75f;
+
+// Collapses of a pass may cost this much more than the cheapest collapses
+// needed to reach the target.
+constexpr double kMaxPassCostRatio = 1.5;
+
+// Collapses turning a face by more than about 78 degrees fold the surface over
+// and are rejected.
+constexpr double kMinFaceNormalCos = 0.2;
+
+// Sum of the squared distances to a set of planes, stored as the upper half of
+// a symmetric 4x4 matrix.
+class Quadric {
+ public:
+  Quadric() : m_{} {}
+
+  // Adds the plane n.p + d = 0 with the unit normal n = (a, b, c).
+  void AddPlane(double a, double b, double c, double d) {
+    m_[0] += a * a;
+    m_[1] += a * b;
+    m_[2] += a * c;
+    m_[3] += a * d;
+    m_[4] += b * b;
+    m_[5] += b * c;
+    m_[6] += b * d;
+    m_[7] += c * c;
+    m_[8] += c * d;
+    m_[9] += d * d;
+  }
+
+  void Add(const Quadric &other) {
+    for (int i = 0; i < 10; ++i) {
+      m_[i] += other.m_[i];
+    }
+  }
+
+  double Evaluate(const Vector3f &p) const {
+    const double x = p[0];
+    const double y = p[1];
+    const double z = p[2];
+    const double error = m_[0] * x * x + m_[4] * y * y + m_[7] * z * z +
+                         2 * (m_[1] * x * y + m_[2] * x * z + m_[5] * y * z) +
+                         2 * (m_[3] * x + m_[6] * y + m_[8] * z) + m_[9];
+    // Rounding can make the error of points on all planes slightly negative.
+    return std::max(error, 0.0);
+  }
+
+ private:
+  double m_[10];
+};
+
+// Moves the vertex |from| onto its neighbour |to|.
+struct Collapse {
+  double cost;
+  // Squared length of the edge. Shorter edges go first among collapses of the
+  // same cost, otherwise flat regions collapse into fans of slivers.
+  double squared_length;
+  VertexIndex from;
+  VertexIndex to;
+
+  bool operator<(const Collapse &other) const {
+    if (cost != other.cost) {
+      return cost < other.cost;
+    }
+    if (squared_length != other.squared_length) {
+      return squared_length < other.squared_length;
+    }
+    if (from != other.from) {
+      return from < other.from;
+    }
+    return to < other.to;
+  }
+};
+
+// Half-edge collapses ordered by their quadric error. The adjacency comes from
+// the corner table of the positions and is then updated with every collapse.
+// Collapses are made in passes: each pass evaluates all edges, sorts the
+// cheapest ones and applies those whose vertices weren't part of an earlier
+// collapse of the same pass. This is much faster than keeping a priority queue
+// up to date and gives nearly the same order.
+class EdgeCollapser {
+ public:
+  bool Init(const Mesh &mesh);
+
+  // Collapses edges until at most |target_num_faces| faces are left or no
+  // valid collapse remains.
+  void CollapseUntil(int target_num_faces);
+
+  // Stores the faces that are left.
+  void StoreLevel(MeshLod *lod) const;
+
+  int num_faces() const { return num_faces_; }
+
+ private:
+  // Returns the corner of |face| at vertex |v|, or -1 if |v| isn't on it.
+  int LocalCorner(FaceIndex face, VertexIndex v) const {
+    for (int i = 0; i < 3; ++i) {
+      if (faces_[face][i] == v) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  void GatherNeighbours(VertexIndex v, std::vector<VertexIndex> *out) const;
+  void GatherCollapses();
+
+  // Applies the valid collapses of collapses_[begin, end) in order until at
+  // most |target_num_faces| faces are left. Returns the number of collapses.
+  int ApplyCollapses(size_t begin, size_t end, int target_num_faces);
+
+  // Checks that moving |from| onto |to| keeps the mesh manifold and doesn't
+  // fold any face over. Returns the point that replaces the points of |from|
+  // in |out_to_point|.
+  bool CanCollapse(VertexIndex from, VertexIndex to,
+                   PointIndex *out_to_point);
+  void ApplyCollapse(const Collapse &collapse, PointIndex to_point);
+
+  IndexTypeVector<VertexIndex, Vector3f> positions_;
+  IndexTypeVector<VertexIndex, Quadric> quadrics_;
+  IndexTypeVector<VertexIndex, std::vector<FaceIndex>> vertex_faces_;
+  IndexTypeVector<VertexIndex, bool> is_locked_;
+  // Vertices changed by a collapse of the current pass.
+  IndexTypeVector<VertexIndex, bool> is_touched_;
+  IndexTypeVector<FaceIndex, std::array<VertexIndex, 3>> faces_;
+  IndexTypeVector<FaceIndex, std::array<PointIndex, 3>> face_points_;
+  IndexTypeVector<FaceIndex, bool> is_face_removed_;
+  std::vector<Collapse> collapses_;
+  std::vector<VertexIndex> touched_vertices_;
+  int num_faces_ = 0;
+  double max_cost_ = 0.0;
+
+  // Scratch space of CanCollapse().
+  std::vector<VertexIndex> from_neighbours_;
+  std::vector<VertexIndex> to_neighbours_;
+};
+
+bool EdgeCollapser::Init(const Mesh &mesh) {
+  const std::unique_ptr<CornerTable> corner_table =
+      CreateCornerTableFromPositionAttribute(&mesh);
+  if (corner_table == nullptr) {
+    return false;
+  }
+  const PointAttribute *const position_att =
+      mesh.GetNamedAttribute(GeometryAttribute::POSITION);
+
+  const int num_vertices = corner_table->num_vertices();
+  positions_.resize(num_vertices);
+  quadrics_.resize(num_vertices);
+  vertex_faces_.resize(num_vertices);
+  is_locked_.assign(num_vertices, false);
+  is_touched_.assign(num_vertices, false);
+  for (VertexIndex v(0); v < num_vertices; ++v) {
+    // Vertices split off non-manifold vertices share the position value of
+    // their parent.
+    const AttributeValueIndex value(corner_table->VertexParent(v).value());
+    positions_[v] = Vector3f(0.f, 0.f, 0.f);
+    position_att->ConvertValue<float>(value, 3, &positions_[v][0]);
+  }
+
+  const int num_faces = corner_table->num_faces();
+  faces_.resize(num_faces);
+  face_points_.resize(num_faces);
+  is_face_removed_.assign(num_faces, false);
+  for (FaceIndex f(0); f < num_faces; ++f) {
+    if (corner_table->IsDegenerated(f)) {
+      is_face_removed_[f] = true;
+      continue;
+    }
+    const CornerIndex first_corner = corner_table->FirstCorner(f);
+    for (int i = 0; i < 3; ++i) {
+      faces_[f][i] = corner_table->Vertex(first_corner + i);
+      face_points_[f][i] = mesh.CornerToPointId(first_corner + i);
+      vertex_faces_[faces_[f][i]].push_back(f);
+    }
+    ++num_faces_;
+
+    // Every vertex starts with the planes of its faces.
+    Vector3f normal = CrossProduct(positions_[faces_[f][1]] -
+                                       positions_[faces_[f][0]],
+                                   positions_[faces_[f][2]] -
+                                       positions_[faces_[f][0]]);
+    const float length = std::sqrt(normal.SquaredNorm());
+    if (length == 0.f) {
+      continue;
+    }
+    normal = normal / length;
+    Quadric plane;
+    plane.AddPlane(normal[0], normal[1], normal[2],
+                   -normal.Dot(positions_[faces_[f][0]]));
+    for (int i = 0; i < 3; ++i) {
+      quadrics_[faces_[f][i]].Add(plane);
+    }
+  }
+
+  for (VertexIndex v(0); v < num_vertices; ++v) {
+    if (vertex_faces_[v].empty() ||
+        corner_table->LeftMostCorner(v) == kInvalidCornerIndex) {
+      is_locked_[v] = true;
+      continue;
+    }
+    if (v.value() >= static_cast<uint32_t>(
+                         corner_table->NumOriginalVertices())) {
+      is_locked_[v] = true;
+      is_locked_[corner_table->VertexParent(v)] = true;
+      continue;
+    }
+    if (corner_table->IsOnBoundary(v)) {
+      is_locked_[v] = true;
+      continue;
+    }
+    // Vertices on attribute seams have more than one point.
+    const PointIndex point =
+        mesh.CornerToPointId(corner_table->LeftMostCorner(v));
+    for (VertexCornersIterator<CornerTable> it(corner_table.get(), v);
+         !it.End(); it.Next()) {
+      if (mesh.CornerToPointId(it.Corner()) != point) {
+        is_locked_[v] = true;
+        break;
+      }
+    }
+  }
+  return true;
+}
+
+void EdgeCollapser::GatherNeighbours(VertexIndex v,
+                                     std::vector<VertexIndex> *out) const {
+  out->clear();
+  for (const FaceIndex &f : vertex_faces_[v]) {
+    if (is_face_removed_[f]) {
+      continue;
+    }
+    for (int i = 0; i < 3; ++i) {
+      if (faces_[f][i] != v) {
+        out->push_back(faces_[f][i]);
+      }
+    }
+  }
+  std::sort(out->begin(), out->end());
+  out->erase(std::unique(out->begin(), out->end()), out->end());
+}
+
+void EdgeCollapser::GatherCollapses() {
+  collapses_.clear();
+  for (FaceIndex f(0); f < static_cast<uint32_t>(faces_.size()); ++f) {
+    if (is_face_removed_[f]) {
+      continue;
+    }
+    // Every interior edge is on two faces, once in each direction.
+    for (int i = 0; i < 3; ++i) {
+      const VertexIndex from = faces_[f][i];
+      const VertexIndex to = faces_[f][(i + 1) % 3];
+      if (is_locked_[from]) {
+        continue;
+      }
+      Quadric quadric = quadrics_[from];
+      quadric.Add(quadrics_[to]);
+      collapses_.push_back({quadric.Evaluate(positions_[to]),
+                            (positions_[to] - positions_[from]).SquaredNorm(),
+                            from, to});
+    }
+  }
+}
+
+bool EdgeCollapser::CanCollapse(VertexIndex from, VertexIndex to,
+                                PointIndex *out_to_point) {
+  int num_shared_faces = 0;
+  PointIndex to_point = kInvalidPointIndex;
+  for (const FaceIndex &f : vertex_faces_[from]) {
+    if (is_face_removed_[f]) {
+      continue;
+    }
+    const int to_corner = LocalCorner(f, to);
+    if (to_corner >= 0) {
+      // Both faces on the edge must use the same point at |to|, which is the
+      // one matching the attributes around |from|.
+      if (to_point != kInvalidPointIndex &&
+          to_point != face_points_[f][to_corner]) {
+        return false;
+      }
+      to_point = face_points_[f][to_corner];
+      ++num_shared_faces;
+      continue;
+    }
+    const int from_corner = LocalCorner(f, from);
+    const Vector3f &a = positions_[faces_[f][(from_corner + 1) % 3]];
+    const Vector3f &b = positions_[faces_[f][(from_corner + 2) % 3]];
+    const Vector3f old_normal =
+        CrossProduct(a - positions_[from], b - positions_[from]);
+    const Vector3f new_normal =
+        CrossProduct(a - positions_[to], b - positions_[to]);
+    const double new_squared_norm = new_normal.SquaredNorm();
+    if (new_squared_norm == 0.0 ||
+        old_normal.Dot(new_normal) <
+            kMinFaceNormalCos *
+                std::sqrt(old_normal.SquaredNorm() * new_squared_norm)) {
+      return false;
+    }
+  }
+  if (num_shared_faces != 2) {
+    return false;
+  }
+
+  // The only common neighbours may be the opposite vertices of the two faces
+  // on the edge, otherwise the collapse creates non-manifold edges.
+  GatherNeighbours(from, &from_neighbours_);
+  GatherNeighbours(to, &to_neighbours_);
+  int num_common_neighbours = 0;
+  auto from_it = from_neighbours_.begin();
+  auto to_it = to_neighbours_.begin();
+  while (from_it != from_neighbours_.end() && to_it != to_neighbours_.end()) {
+    if (*from_it < *to_it) {
+      ++from_it;
+    } else if (*to_it < *from_it) {
+      ++to_it;
+    } else {
+      ++num_common_neighbours;
+      ++from_it;
+      ++to_it;
+    }
+  }
+  if (num_common_neighbours != 2) {
+    return false;
+  }
+  *out_to_point = to_point;
+  return true;
+}
+
+void EdgeCollapser::ApplyCollapse(const Collapse &collapse,
+                                  PointIndex to_point) {
+  const VertexIndex from = collapse.from;
+  const VertexIndex to = collapse.to;
+  quadrics_[to].Add(quadrics_[from]);
+
+  std::vector<FaceIndex> &to_faces = vertex_faces_[to];
+  for (const FaceIndex &f : vertex_faces_[from]) {
+    if (is_face_removed_[f]) {
+      continue;
+    }
+    if (LocalCorner(f, to) >= 0) {
+      is_face_removed_[f] = true;
+      --num_faces_;
+      continue;
+    }
+    const int from_corner = LocalCorner(f, from);
+    faces_[f][from_corner] = to;
+    face_points_[f][from_corner] = to_point;
+    to_faces.push_back(f);
+  }
+  std::vector<FaceIndex>().swap(vertex_faces_[from]);
+  to_faces.erase(std::remove_if(to_faces.begin(), to_faces.end(),
+                                [this](FaceIndex f) {
+                                  return is_face_removed_[f];
+                                }),
+                 to_faces.end());
+
+  max_cost_ = std::max(max_cost_, collapse.cost);
+
+  // The costs of the edges at |to| changed, they wait for the next pass. Other
+  // collapses in the neighbourhood keep their cost and CanCollapse() checks
+  // them against the updated faces.
+  for (const VertexIndex &v : {from, to}) {
+    if (!is_touched_[v]) {
+      is_touched_[v] = true;
+      touched_vertices_.push_back(v);
+    }
+  }
+}
+
+int EdgeCollapser::ApplyCollapses(size_t begin, size_t end,
+                                  int target_num_faces) {
+  int num_applied = 0;
+  for (size_t i = begin; i < end && num_faces_ > target_num_faces; ++i) {
+    const Collapse &collapse = collapses_[i];
+    if (is_touched_[collapse.from] || is_touched_[collapse.to]) {
+      continue;
+    }
+    PointIndex to_point;
+    if (!CanCollapse(collapse.from, collapse.to, &to_point)) {
+      continue;
+    }
+    ApplyCollapse(collapse, to_point);
+    ++num_applied;
+  }
+  return num_applied;
+}
+
+void EdgeCollapser::CollapseUntil(int target_num_faces) {
+  while (num_faces_ > target_num_faces) {
+    GatherCollapses();
+
+    if (collapses_.empty()) {
+      return;
+    }
+
+    // Each collapse removes two faces. Only the collapses costing up to a bit
+    // more than the cheapest ones needed to reach the target are sorted and
+    // applied, the others are evaluated again in the next pass.
+    const size_t num_needed =
+        std::min<size_t>((num_faces_ - target_num_faces + 1) / 2,
+                         collapses_.size() - 1);
+    std::nth_element(collapses_.begin(), collapses_.begin() + num_needed,
+                     collapses_.end());
+    const double max_pass_cost =
+        collapses_[num_needed].cost * kMaxPassCostRatio;
+    const auto pass_end = std::partition(
+        collapses_.begin() + num_needed, collapses_.end(),
+        [max_pass_cost](const Collapse &c) { return c.cost <= max_pass_cost; });
+    std::sort(collapses_.begin(), pass_end);
+    const size_t num_pass = pass_end - collapses_.begin();
+    int num_applied = ApplyCollapses(0, num_pass, target_num_faces);
+    if (num_applied == 0) {
+      // None of the cheap collapses is valid, try the others.
+      std::sort(pass_end, collapses_.end());
+      num_applied = ApplyCollapses(num_pass, collapses_.size(), target_num_faces);
+    }
+
+    for (const VertexIndex &v : touched_vertices_) {
+      is_touched_[v] = false;
+    }
+    touched_vertices_.clear();
+    if (num_applied == 0) {
+      return;
+    }
+  }
+}
+
+void EdgeCollapser::StoreLevel(MeshLod *lod) const {
+  lod->error = static_cast<float>(std::sqrt(max_cost_));
+  lod->indices.clear();
+  lod->indices.reserve(num_faces_ * 3);
+  for (FaceIndex f(0); f < static_cast<uint32_t>(faces_.size()); ++f) {
+    if (is_face_removed_[f]) {
+      continue;
+    }
+    for (int i = 0; i < 3; ++i) {
+      lod->indices.push_back(face_points_[f][i].value());
+    }
+  }
+}
+
+}  // namespace
+
+Status MeshLodGenerator::Generate(const Mesh &mesh,
+                                  const MeshLodOptions &options,
+                                  std::vector<MeshLod> *out_lods) {
+  DRACO_TRACE_ZONE("GenerateLods");
+  out_lods->clear();
+  if (mesh.num_faces() == 0) {
+    return OkStatus();
+  }
+  EdgeCollapser collapser;
+  if (!collapser.Init(mesh)) {
+    return ErrorStatus("Mesh has no position attribute.");
+  }
+
+  int num_faces = collapser.num_faces();
+  while (static_cast<int>(out_lods->size()) < options.max_num_levels) {
+    const int target_num_faces =
+        static_cast<int>(num_faces * options.face_ratio);
+    if (target_num_faces < options.min_num_faces) {
+      break;
+    }
+    collapser.CollapseUntil(target_num_faces);
+    if (collapser.num_faces() > num_faces * kMinLevelReduction) {
+      break;
+    }
+    out_lods->emplace_back();
+    collapser.StoreLevel(&out_lods->back());
+    num_faces = collapser.num_faces();
+  }
+  return OkStatus();
+}
+
+}  // namespace draco
@@ -0,0 +1,68 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_MESH_MESH_LOD_GENERATOR_H_
+#define DRACO_MESH_MESH_LOD_GENERATOR_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "draco/core/status.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Options used by the MeshLodGenerator class.
+struct MeshLodOptions {
+  // Every level keeps at most this fraction of the faces of the previous level
+  // (or of the source mesh for the first level).
+  float face_ratio = 0.5f;
+
+  // No level is generated with fewer faces than this.
+  int min_num_faces = 16;
+
+  // Maximum number of generated levels.
+  int max_num_levels = 8;
+};
+
+// One level of detail of a mesh.
+struct MeshLod {
+  // Largest quadric error of the collapses made so far, as a distance in the
+  // units of the positions.
+  float error = 0.f;
+
+  // Triangle list referencing the point ids of the source mesh.
+  std::vector<uint32_t> indices;
+};
+
+// Generates levels of detail of a draco::Mesh with quadric error metric edge
+// collapses (Garland and Heckbert, "Surface Simplification Using Quadric Error
+// Metrics"). Vertices are only collapsed onto one of their neighbours, so all
+// levels reuse the points of the source mesh and only the faces change. The
+// levels come from a single collapse sequence where each level continues from
+// the previous one. The adjacency is taken from the corner table of the
+// positions. Vertices on borders, on attribute seams and non-manifold vertices
+// are never moved, which keeps the outline and the texture layout intact.
+class MeshLodGenerator {
+ public:
+  // Generates the levels of |mesh| from the most to the least detailed one
+  // and stores them in |out_lods|. No levels are generated when the mesh can't
+  // be simplified by at least a quarter of its faces.
+  static Status Generate(const Mesh &mesh, const MeshLodOptions &options,
+                         std::vector<MeshLod> *out_lods);
+};
+
+}  // namespace draco
+
+#endif  // DRACO_MESH_MESH_LOD_GENERATOR_H_
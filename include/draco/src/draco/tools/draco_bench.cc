@@ -0,0 +1,1536 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Micro-benchmarks of the hot loops of the Draco decoder. All inputs are
+// synthetic and generated with fixed seeds, so the numbers of two builds can
+// be compared directly. Every kernel is run several times and the fastest run
+// is reported in nanoseconds per decoded element. The decoded output of each
+// kernel is checked against the encoder input. The vector kernels are run for
+// every instruction set supported by the CPU.
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "draco/attributes/attribute_octahedron_transform.h"
+#include "draco/attributes/attribute_quantization_transform.h"
+#include "draco/compression/attributes/normal_compression_utils.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_constrained_multi_parallelogram_decoder.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_constrained_multi_parallelogram_encoder.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_data.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_geometric_normal_decoder.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_geometric_normal_encoder.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_multi_parallelogram_decoder.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_multi_parallelogram_encoder.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_parallelogram_decoder.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_parallelogram_encoder.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_tex_coords_portable_decoder.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_tex_coords_portable_encoder.h"
+#include "draco/compression/attributes/prediction_schemes/prediction_scheme_delta_decoder.h"
+#include "draco/compression/attributes/prediction_schemes/prediction_scheme_delta_encoder.h"
+#include "draco/compression/attributes/prediction_schemes/prediction_scheme_normal_octahedron_canonicalized_decoding_transform.h"
+#include "draco/compression/attributes/prediction_schemes/prediction_scheme_normal_octahedron_canonicalized_encoding_transform.h"
+#include "draco/compression/attributes/prediction_schemes/prediction_scheme_wrap_decoding_transform.h"
+#include "draco/compression/attributes/prediction_schemes/prediction_scheme_wrap_encoding_transform.h"
+#include "draco/compression/bit_coders/adaptive_rans_bit_decoder.h"
+#include "draco/compression/bit_coders/adaptive_rans_bit_encoder.h"
+#include "draco/compression/bit_coders/rans_bit_decoder.h"
+#include "draco/compression/bit_coders/rans_bit_encoder.h"
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/decode.h"
+#include "draco/compression/encode.h"
+#include "draco/compression/entropy/symbol_decoding.h"
+#include "draco/compression/entropy/symbol_encoding.h"
+#include "draco/compression/mesh/mesh_edgebreaker_decoder.h"
+#include "draco/compression/mesh/mesh_sequential_decoder.h"
+#include "draco/core/bit_utils.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/quantization_utils.h"
+#include "draco/core/varint_decoding.h"
+#include "draco/core/varint_encoding.h"
+#include "draco/core/vector_kernels.h"
+#include "draco/mesh/corner_table.h"
+#include "draco/mesh/mesh.h"
+#include "draco/point_cloud/point_cloud_builder.h"
+
+namespace {
+
+using draco::AttributeValueIndex;
+using draco::CornerIndex;
+using draco::CornerTable;
+using draco::DecoderBuffer;
+using draco::EncoderBuffer;
+using draco::FaceIndex;
+using draco::GeometryAttribute;
+using draco::IndexTypeVector;
+using draco::Mesh;
+using draco::PointAttribute;
+using draco::PointIndex;
+using draco::VertexIndex;
+
+struct Options {
+  Options();
+
+  // Only benchmarks whose name contains |filter| are run.
+  std::string filter;
+  // Number of timed runs of every kernel.
+  int repetitions;
+  // Number of values used by the entropy coding benchmarks.
+  int num_values;
+  // Number of vertices along one side of the benchmark grid mesh.
+  int grid_size;
+  // Number of points of the benchmark point cloud.
+  int num_points;
+};
+
+Options::Options()
+    : repetitions(5),
+      num_values(1 << 20),
+      grid_size(512),
+      num_points(1 << 20) {}
+
+void Usage() {
+  printf("Usage: draco_bench [options]\n");
+  printf("\n");
+  printf("Benchmarks the main decoding kernels and the encoder of the Draco\n");
+  printf("library.\n");
+  printf("\n");
+  printf("Options:\n");
+  printf("  -h | -?         show help.\n");
+  printf("  -filter <name>  run only benchmarks containing <name>.\n");
+  printf("  -r <value>      number of timed runs per benchmark, default=5.\n");
+  printf("  -n <value>      number of values for the entropy coding\n");
+  printf("                  benchmarks, default=1048576.\n");
+  printf("  -grid <value>   vertices along one side of the benchmark mesh,\n");
+  printf("                  default=512.\n");
+  printf("  -points <value> number of points of the benchmark point cloud,\n");
+  printf("                  default=1048576.\n");
+}
+
+int StringToInt(const std::string &s) {
+  char *end;
+  return strtol(s.c_str(), &end, 10);  // NOLINT
+}
+
+// Measures the time spent between Start() and Stop(). A kernel may start and
+// stop the stopwatch several times, the intervals are summed up.
+class Stopwatch {
+ public:
+  Stopwatch() : elapsed_ns_(0) {}
+
+  void Start() { start_ = std::chrono::steady_clock::now(); }
+  void Stop() {
+    elapsed_ns_ += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now() - start_)
+                       .count();
+  }
+  int64_t elapsed_ns() const { return elapsed_ns_; }
+
+ private:
+  std::chrono::steady_clock::time_point start_;
+  int64_t elapsed_ns_;
+};
+
+// Runs |kernel| the configured number of times and prints the time of the
+// fastest run divided by |num_elements|. The kernel does its own untimed
+// setup and only wraps the measured code in the stopwatch. Returns false when
+// the kernel reports an error.
+bool RunBenchmark(const Options &options, const std::string &name,
+                  const char *element_name, int64_t num_elements,
+                  const std::function<bool(Stopwatch *)> &kernel) {
+  if (name.find(options.filter) == std::string::npos) {
+    return true;
+  }
+  int64_t best_ns = -1;
+  for (int i = 0; i < options.repetitions; ++i) {
+    Stopwatch stopwatch;
+    if (!kernel(&stopwatch)) {
+      printf("%-58s FAILED\n", name.c_str());
+      return false;
+    }
+    if (best_ns < 0 || stopwatch.elapsed_ns() < best_ns) {
+      best_ns = stopwatch.elapsed_ns();
+    }
+  }
+  printf("%-58s %9.3f ns/%-8s (%" PRId64 " %ss)\n", name.c_str(),
+         static_cast<double>(best_ns) / num_elements, element_name,
+         num_elements, element_name);
+  return true;
+}
+
+void InitDecoderBuffer(const EncoderBuffer &encoder_buffer,
+                       DecoderBuffer *buffer) {
+  buffer->Init(encoder_buffer.data(), encoder_buffer.size());
+  buffer->set_bitstream_version(draco::kDracoMeshBitstreamVersion);
+}
+
+// Returns |num_values| symbols with the roughly geometric distribution of
+// prediction corrections.
+std::vector<uint32_t> GenerateSymbols(int num_values, double mean) {
+  std::mt19937 generator(42);
+  std::geometric_distribution<uint32_t> distribution(1.0 / (mean + 1.0));
+  std::vector<uint32_t> symbols(num_values);
+  for (int i = 0; i < num_values; ++i) {
+    symbols[i] = distribution(generator);
+  }
+  return symbols;
+}
+
+bool BenchmarkSymbolDecoding(const Options &options,
+                             draco::SymbolCodingMethod method,
+                             const std::string &name) {
+  const int num_components = 3;
+  const int num_values = options.num_values - options.num_values % 3;
+  const std::vector<uint32_t> symbols = GenerateSymbols(num_values, 20.0);
+  draco::Options encoding_options;
+  draco::SetSymbolEncodingMethod(&encoding_options, method);
+  EncoderBuffer encoder_buffer;
+  if (!draco::EncodeSymbols(symbols.data(), num_values, num_components,
+                            &encoding_options, &encoder_buffer)) {
+    return false;
+  }
+  std::vector<uint32_t> decoded(num_values);
+  return RunBenchmark(
+      options, name, "symbol", num_values, [&](Stopwatch *stopwatch) {
+        DecoderBuffer buffer;
+        InitDecoderBuffer(encoder_buffer, &buffer);
+        stopwatch->Start();
+        const bool ok = draco::DecodeSymbols(num_values, num_components,
+                                             &buffer, decoded.data());
+        stopwatch->Stop();
+        return ok && decoded == symbols;
+      });
+}
+
+template <class BitEncoderT, class BitDecoderT>
+bool BenchmarkBitDecoding(const Options &options, const std::string &name) {
+  const int num_values = options.num_values;
+  std::mt19937 generator(7);
+  std::bernoulli_distribution distribution(0.2);
+  std::vector<bool> bits(num_values);
+  BitEncoderT encoder;
+  encoder.StartEncoding();
+  for (int i = 0; i < num_values; ++i) {
+    bits[i] = distribution(generator);
+    encoder.EncodeBit(bits[i]);
+  }
+  EncoderBuffer encoder_buffer;
+  encoder.EndEncoding(&encoder_buffer);
+  std::vector<bool> decoded(num_values);
+  return RunBenchmark(options, name, "bit", num_values,
+                      [&](Stopwatch *stopwatch) {
+                        DecoderBuffer buffer;
+                        InitDecoderBuffer(encoder_buffer, &buffer);
+                        BitDecoderT decoder;
+                        stopwatch->Start();
+                        if (!decoder.StartDecoding(&buffer)) {
+                          return false;
+                        }
+                        for (int i = 0; i < num_values; ++i) {
+                          decoded[i] = decoder.DecodeNextBit();
+                        }
+                        decoder.EndDecoding();
+                        stopwatch->Stop();
+                        return decoded == bits;
+                      });
+}
+
+// Benchmarks DecoderBuffer::BitDecoder::GetBits() through the public bit
+// decoding interface of DecoderBuffer.
+bool BenchmarkGetBits(const Options &options) {
+  const int num_values = options.num_values;
+  std::mt19937 generator(11);
+  std::vector<uint32_t> num_bits(num_values);
+  std::vector<uint32_t> values(num_values);
+  int64_t total_bits = 0;
+  for (int i = 0; i < num_values; ++i) {
+    num_bits[i] = 1 + generator() % 20;
+    values[i] = generator() & ((1u << num_bits[i]) - 1);
+    total_bits += num_bits[i];
+  }
+  EncoderBuffer encoder_buffer;
+  encoder_buffer.StartBitEncoding(total_bits, false);
+  for (int i = 0; i < num_values; ++i) {
+    encoder_buffer.EncodeLeastSignificantBits32(num_bits[i], values[i]);
+  }
+  encoder_buffer.EndBitEncoding();
+  std::vector<uint32_t> decoded(num_values);
+  return RunBenchmark(
+      options, "DecoderBuffer::BitDecoder::GetBits", "value", num_values,
+      [&](Stopwatch *stopwatch) {
+        DecoderBuffer buffer;
+        InitDecoderBuffer(encoder_buffer, &buffer);
+        stopwatch->Start();
+        if (!buffer.StartBitDecoding(false, nullptr)) {
+          return false;
+        }
+        for (int i = 0; i < num_values; ++i) {
+          if (!buffer.DecodeLeastSignificantBits32(num_bits[i], &decoded[i])) {
+            return false;
+          }
+        }
+        buffer.EndBitDecoding();
+        stopwatch->Stop();
+        return decoded == values;
+      });
+}
+
+bool BenchmarkVarintDecoding(const Options &options) {
+  const int num_values = options.num_values;
+  std::mt19937 generator(13);
+  std::vector<uint32_t> values(num_values);
+  EncoderBuffer encoder_buffer;
+  for (int i = 0; i < num_values; ++i) {
+    // Spread the values evenly over all encoded lengths.
+    values[i] = generator() >> (generator() % 32);
+    draco::EncodeVarint(values[i], &encoder_buffer);
+  }
+  std::vector<uint32_t> decoded(num_values);
+  return RunBenchmark(options, "DecodeVarint<uint32_t>", "value", num_values,
+                      [&](Stopwatch *stopwatch) {
+                        DecoderBuffer buffer;
+                        InitDecoderBuffer(encoder_buffer, &buffer);
+                        stopwatch->Start();
+                        for (int i = 0; i < num_values; ++i) {
+                          if (!draco::DecodeVarint(&decoded[i], &buffer)) {
+                            return false;
+                          }
+                        }
+                        stopwatch->Stop();
+                        return decoded == values;
+                      });
+}
+
+// Regular grid of a smooth height field. Each quad is split along a random
+// diagonal so that the vertex valences are not all the same. Vertices are
+// numbered row by row and all attributes use identity mapping.
+struct GridMesh {
+  explicit GridMesh(int grid_size);
+
+  int grid_size;
+  Mesh mesh;
+  IndexTypeVector<FaceIndex, CornerTable::FaceType> faces;
+  int position_att_id;
+  int normal_att_id;
+  int tex_coord_att_id;
+};
+
+// Adds an attribute with one value per point of |mesh|.
+int AddAttribute(Mesh *mesh, GeometryAttribute::Type type, int num_components,
+                 const std::vector<float> &values) {
+  GeometryAttribute ga;
+  ga.Init(type, nullptr, num_components, draco::DT_FLOAT32, false,
+          sizeof(float) * num_components, 0);
+  const int att_id = mesh->AddAttribute(ga, true, mesh->num_points());
+  PointAttribute *const att = mesh->attribute(att_id);
+  for (uint32_t i = 0; i < mesh->num_points(); ++i) {
+    att->SetAttributeValue(AttributeValueIndex(i), &values[i * num_components]);
+  }
+  return att_id;
+}
+
+GridMesh::GridMesh(int size) : grid_size(size) {
+  std::mt19937 generator(3);
+  std::uniform_real_distribution<float> jitter(-0.05f, 0.05f);
+  const int num_vertices = grid_size * grid_size;
+  std::vector<float> positions(num_vertices * 3);
+  std::vector<float> normals(num_vertices * 3);
+  std::vector<float> tex_coords(num_vertices * 2);
+  for (int y = 0; y < grid_size; ++y) {
+    for (int x = 0; x < grid_size; ++x) {
+      const int v = y * grid_size + x;
+      const float height = 8.f * std::sin(x * 0.05f) * std::cos(y * 0.07f);
+      positions[v * 3] = static_cast<float>(x);
+      positions[v * 3 + 1] = static_cast<float>(y);
+      positions[v * 3 + 2] = height + jitter(generator);
+      // Normal of the height field without the jitter.
+      const float dx = 0.4f * std::cos(x * 0.05f) * std::cos(y * 0.07f);
+      const float dy = -0.56f * std::sin(x * 0.05f) * std::sin(y * 0.07f);
+      const float length = std::sqrt(dx * dx + dy * dy + 1.f);
+      normals[v * 3] = -dx / length;
+      normals[v * 3 + 1] = -dy / length;
+      normals[v * 3 + 2] = 1.f / length;
+      tex_coords[v * 2] = static_cast<float>(x) / (grid_size - 1);
+      tex_coords[v * 2 + 1] = static_cast<float>(y) / (grid_size - 1);
+    }
+  }
+  for (int y = 0; y + 1 < grid_size; ++y) {
+    for (int x = 0; x + 1 < grid_size; ++x) {
+      const VertexIndex v00(y * grid_size + x);
+      const VertexIndex v10(v00.value() + 1);
+      const VertexIndex v01(v00.value() + grid_size);
+      const VertexIndex v11(v01.value() + 1);
+      if (generator() & 1) {
+        faces.push_back({{v00, v10, v11}});
+        faces.push_back({{v00, v11, v01}});
+      } else {
+        faces.push_back({{v00, v10, v01}});
+        faces.push_back({{v10, v11, v01}});
+      }
+    }
+  }
+  mesh.SetNumFaces(faces.size());
+  for (FaceIndex f(0); f < faces.size(); ++f) {
+    Mesh::Face face;
+    for (int c = 0; c < 3; ++c) {
+      face[c] = PointIndex(faces[f][c].value());
+    }
+    mesh.SetFace(f, face);
+  }
+  mesh.set_num_points(num_vertices);
+  position_att_id =
+      AddAttribute(&mesh, GeometryAttribute::POSITION, 3, positions);
+  normal_att_id = AddAttribute(&mesh, GeometryAttribute::NORMAL, 3, normals);
+  tex_coord_att_id =
+      AddAttribute(&mesh, GeometryAttribute::TEX_COORD, 2, tex_coords);
+}
+
+// Grid of boxes of random heights, each with a square hole through it and a
+// fin on one of its top edges, similar to the "cad" family of the corpus
+// generator. The holes give every box a handle, so the Edgebreaker traversal
+// runs into many topology splits. Neighbouring boxes share parts of their
+// side walls and the fins make many edges non-manifold. Only positions are
+// stored and vertices at the same position are shared.
+struct CadMesh {
+  explicit CadMesh(int boxes_per_side);
+
+  Mesh mesh;
+};
+
+CadMesh::CadMesh(int boxes_per_side) {
+  std::mt19937 generator(5);
+  // Outline and hole of a box in quarter units, both counter-clockwise.
+  static const int kOuter[4][2] = {{0, 0}, {0, 4}, {4, 4}, {4, 0}};
+  static const int kInner[4][2] = {{1, 1}, {1, 3}, {3, 3}, {3, 1}};
+  std::map<std::array<int, 3>, int> vertex_ids;
+  std::vector<float> positions;
+  std::vector<std::array<int, 3>> faces;
+  const auto vertex = [&](int x, int y, int z) {
+    const auto inserted =
+        vertex_ids.insert({{x, y, z}, static_cast<int>(vertex_ids.size())});
+    if (inserted.second) {
+      positions.push_back(0.25f * x);
+      positions.push_back(0.25f * y);
+      positions.push_back(0.25f * z);
+    }
+    return inserted.first->second;
+  };
+  const auto add_quad = [&](int v0, int v1, int v2, int v3) {
+    faces.push_back({{v0, v1, v2}});
+    faces.push_back({{v0, v2, v3}});
+  };
+  for (int z = 0; z < boxes_per_side; ++z) {
+    for (int x = 0; x < boxes_per_side; ++x) {
+      const int height = 4 * static_cast<int>(1 + generator() % 3);
+      const auto corner = [&](const int *p, int y) {
+        return vertex(4 * x + p[0], y, 4 * z + p[1]);
+      };
+      for (int i = 0; i < 4; ++i) {
+        const int *const o0 = kOuter[i];
+        const int *const o1 = kOuter[(i + 1) % 4];
+        const int *const i0 = kInner[i];
+        const int *const i1 = kInner[(i + 1) % 4];
+        add_quad(corner(o0, 0), corner(o1, 0), corner(o1, height),
+                 corner(o0, height));
+        add_quad(corner(i1, 0), corner(i0, 0), corner(i0, height),
+                 corner(i1, height));
+        add_quad(corner(o0, height), corner(o1, height),
+                 corner(i1, height), corner(i0, height));
+        add_quad(corner(i0, 0), corner(i1, 0), corner(o1, 0), corner(o0, 0));
+      }
+      const int fin_z = 4 * (z + static_cast<int>(generator() % 2));
+      add_quad(vertex(4 * x, height, fin_z), vertex(4 * x + 4, height, fin_z),
+               vertex(4 * x + 4, height + 2, fin_z),
+               vertex(4 * x, height + 2, fin_z));
+    }
+  }
+  mesh.SetNumFaces(faces.size());
+  for (FaceIndex f(0); f < faces.size(); ++f) {
+    Mesh::Face face;
+    for (int c = 0; c < 3; ++c) {
+      face[c] = PointIndex(faces[f.value()][c]);
+    }
+    mesh.SetFace(f, face);
+  }
+  mesh.set_num_points(vertex_ids.size());
+  AddAttribute(&mesh, GeometryAttribute::POSITION, 3, positions);
+}
+
+// Corner table built with the algorithm CornerTable::Init used before its
+// opposite corner matching was streamlined. CornerTable::Init must produce
+// exactly the same tables. Indices are plain ints, -1 being invalid.
+class ReferenceCornerTable {
+ public:
+  explicit ReferenceCornerTable(
+      const IndexTypeVector<FaceIndex, CornerTable::FaceType> &faces);
+
+  // Returns true when |table| has the same opposite corners, vertices, vertex
+  // corners and counters.
+  bool Matches(const CornerTable &table) const;
+
+ private:
+  int num_corners() const { return static_cast<int>(vertices_.size()); }
+  int Next(int c) const { return c < 0 ? c : (c % 3 == 2 ? c - 2 : c + 1); }
+  int Previous(int c) const { return c < 0 ? c : (c % 3 == 0 ? c + 2 : c - 1); }
+  int Vertex(int c) const { return c < 0 ? -1 : vertices_[c]; }
+  int Opposite(int c) const { return c < 0 ? c : opposite_corners_[c]; }
+  int SwingRight(int c) const { return Previous(Opposite(Previous(c))); }
+  int SwingLeft(int c) const { return Next(Opposite(Next(c))); }
+
+  int ComputeOppositeCorners();
+  void BreakNonManifoldEdges();
+  void ComputeVertexCorners(int num_vertices);
+
+  std::vector<int> vertices_;
+  std::vector<int> opposite_corners_;
+  std::vector<int> vertex_corners_;
+  int num_original_vertices_;
+  int num_degenerated_faces_;
+  int num_isolated_vertices_;
+};
+
+ReferenceCornerTable::ReferenceCornerTable(
+    const IndexTypeVector<FaceIndex, CornerTable::FaceType> &faces)
+    : num_original_vertices_(0),
+      num_degenerated_faces_(0),
+      num_isolated_vertices_(0) {
+  vertices_.resize(faces.size() * 3);
+  for (FaceIndex f(0); f < faces.size(); ++f) {
+    for (int i = 0; i < 3; ++i) {
+      vertices_[f.value() * 3 + i] = faces[f][i].value();
+    }
+  }
+  const int num_vertices = ComputeOppositeCorners();
+  BreakNonManifoldEdges();
+  ComputeVertexCorners(num_vertices);
+}
+
+// Half-edges are stored on their source vertex with the number of slots of
+// each vertex grown corner by corner, and matched one corner at a time.
+int ReferenceCornerTable::ComputeOppositeCorners() {
+  opposite_corners_.assign(num_corners(), -1);
+  std::vector<int> num_corners_on_vertices;
+  for (int c = 0; c < num_corners(); ++c) {
+    const int v = Vertex(c);
+    if (v >= static_cast<int>(num_corners_on_vertices.size())) {
+      num_corners_on_vertices.resize(v + 1, 0);
+    }
+    num_corners_on_vertices[v]++;
+  }
+  struct VertexEdgePair {
+    int sink_vert = -1;
+    int edge_corner = -1;
+  };
+  std::vector<VertexEdgePair> vertex_edges(num_corners());
+  std::vector<int> vertex_offset(num_corners_on_vertices.size());
+  int offset = 0;
+  for (size_t i = 0; i < num_corners_on_vertices.size(); ++i) {
+    vertex_offset[i] = offset;
+    offset += num_corners_on_vertices[i];
+  }
+  for (int c = 0; c < num_corners(); ++c) {
+    const int tip_v = Vertex(c);
+    const int source_v = Vertex(Next(c));
+    const int sink_v = Vertex(Previous(c));
+    if (c % 3 == 0 &&
+        (tip_v == source_v || tip_v == sink_v || source_v == sink_v)) {
+      ++num_degenerated_faces_;
+      c += 2;
+      continue;
+    }
+    int opposite_c = -1;
+    const int num_corners_on_vert = num_corners_on_vertices[sink_v];
+    offset = vertex_offset[sink_v];
+    for (int i = 0; i < num_corners_on_vert; ++i, ++offset) {
+      const int other_v = vertex_edges[offset].sink_vert;
+      if (other_v == -1) {
+        break;
+      }
+      if (other_v == source_v) {
+        if (tip_v == Vertex(vertex_edges[offset].edge_corner)) {
+          continue;  // Mirrored faces aren't connected.
+        }
+        opposite_c = vertex_edges[offset].edge_corner;
+        for (int j = i + 1; j < num_corners_on_vert; ++j, ++offset) {
+          vertex_edges[offset] = vertex_edges[offset + 1];
+          if (vertex_edges[offset].sink_vert == -1) {
+            break;
+          }
+        }
+        vertex_edges[offset].sink_vert = -1;
+        break;
+      }
+    }
+    if (opposite_c == -1) {
+      offset = vertex_offset[source_v];
+      for (int i = 0; i < num_corners_on_vertices[source_v]; ++i, ++offset) {
+        if (vertex_edges[offset].sink_vert == -1) {
+          vertex_edges[offset].sink_vert = sink_v;
+          vertex_edges[offset].edge_corner = c;
+          break;
+        }
+      }
+    } else {
+      opposite_corners_[c] = opposite_c;
+      opposite_corners_[opposite_c] = c;
+    }
+  }
+  return static_cast<int>(num_corners_on_vertices.size());
+}
+
+void ReferenceCornerTable::BreakNonManifoldEdges() {
+  std::vector<bool> visited_corners(num_corners(), false);
+  std::vector<std::pair<int, int>> sink_vertices;
+  bool mesh_connectivity_updated = false;
+  do {
+    mesh_connectivity_updated = false;
+    for (int c = 0; c < num_corners(); ++c) {
+      if (visited_corners[c]) {
+        continue;
+      }
+      sink_vertices.clear();
+      int first_c = c;
+      int current_c = c;
+      int next_c;
+      while (next_c = SwingLeft(current_c), next_c != first_c &&
+                                                next_c != -1 &&
+                                                !visited_corners[next_c]) {
+        current_c = next_c;
+      }
+      first_c = current_c;
+      do {
+        visited_corners[current_c] = true;
+        const int sink_c = Next(current_c);
+        const int sink_v = vertices_[sink_c];
+        const int edge_corner = Previous(current_c);
+        bool vertex_connectivity_updated = false;
+        for (const auto &attached_sink_vertex : sink_vertices) {
+          if (attached_sink_vertex.first == sink_v) {
+            const int other_edge_corner = attached_sink_vertex.second;
+            const int opp_edge_corner = Opposite(edge_corner);
+            if (opp_edge_corner == other_edge_corner) {
+              continue;
+            }
+            const int opp_other_edge_corner = Opposite(other_edge_corner);
+            if (opp_edge_corner != -1) {
+              opposite_corners_[opp_edge_corner] = -1;
+            }
+            if (opp_other_edge_corner != -1) {
+              opposite_corners_[opp_other_edge_corner] = -1;
+            }
+            opposite_corners_[edge_corner] = -1;
+            opposite_corners_[other_edge_corner] = -1;
+            vertex_connectivity_updated = true;
+            break;
+          }
+        }
+        if (vertex_connectivity_updated) {
+          mesh_connectivity_updated = true;
+          break;
+        }
+        sink_vertices.push_back({vertices_[Previous(current_c)], sink_c});
+        current_c = SwingRight(current_c);
+      } while (current_c != first_c && current_c != -1);
+    }
+  } while (mesh_connectivity_updated);
+}
+
+void ReferenceCornerTable::ComputeVertexCorners(int num_vertices) {
+  num_original_vertices_ = num_vertices;
+  vertex_corners_.assign(num_vertices, -1);
+  std::vector<bool> visited_vertices(num_vertices, false);
+  std::vector<bool> visited_corners(num_corners(), false);
+  for (int first_face_corner = 0; first_face_corner < num_corners();
+       first_face_corner += 3) {
+    const int v0 = vertices_[first_face_corner];
+    const int v1 = vertices_[first_face_corner + 1];
+    const int v2 = vertices_[first_face_corner + 2];
+    if (v0 == v1 || v0 == v2 || v1 == v2) {
+      continue;
+    }
+    for (int k = 0; k < 3; ++k) {
+      const int c = first_face_corner + k;
+      if (visited_corners[c]) {
+        continue;
+      }
+      int v = vertices_[c];
+      bool is_non_manifold_vertex = false;
+      if (visited_vertices[v]) {
+        vertex_corners_.push_back(-1);
+        visited_vertices.push_back(false);
+        v = num_vertices++;
+        is_non_manifold_vertex = true;
+      }
+      visited_vertices[v] = true;
+      int act_c = c;
+      while (act_c != -1) {
+        visited_corners[act_c] = true;
+        vertex_corners_[v] = act_c;
+        if (is_non_manifold_vertex) {
+          vertices_[act_c] = v;
+        }
+        act_c = SwingLeft(act_c);
+        if (act_c == c) {
+          break;
+        }
+      }
+      if (act_c == -1) {
+        act_c = SwingRight(c);
+        while (act_c != -1) {
+          visited_corners[act_c] = true;
+          if (is_non_manifold_vertex) {
+            vertices_[act_c] = v;
+          }
+          act_c = SwingRight(act_c);
+        }
+      }
+    }
+  }
+  num_isolated_vertices_ = 0;
+  for (const bool visited : visited_vertices) {
+    if (!visited) {
+      ++num_isolated_vertices_;
+    }
+  }
+}
+
+bool ReferenceCornerTable::Matches(const CornerTable &table) const {
+  // Invalid indices of the table wrap around to -1.
+  const auto to_int = [](uint32_t value) { return static_cast<int>(value); };
+  if (table.num_corners() != num_corners() ||
+      table.num_vertices() != static_cast<int>(vertex_corners_.size()) ||
+      table.NumDegeneratedFaces() != num_degenerated_faces_ ||
+      table.NumNewVertices() !=
+          static_cast<int>(vertex_corners_.size()) - num_original_vertices_ ||
+      table.NumIsolatedVertices() != num_isolated_vertices_) {
+    return false;
+  }
+  for (CornerIndex c(0); c < table.num_corners(); ++c) {
+    if (to_int(table.Opposite(c).value()) != opposite_corners_[c.value()] ||
+        to_int(table.Vertex(c).value()) != vertices_[c.value()]) {
+      return false;
+    }
+  }
+  for (VertexIndex v(0); v < table.num_vertices(); ++v) {
+    if (to_int(table.LeftMostCorner(v).value()) !=
+        vertex_corners_[v.value()]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Faces of |mesh| as the vertex indices used by CornerTable::Init.
+IndexTypeVector<FaceIndex, CornerTable::FaceType> GetFaces(const Mesh &mesh) {
+  IndexTypeVector<FaceIndex, CornerTable::FaceType> faces(mesh.num_faces());
+  for (FaceIndex f(0); f < mesh.num_faces(); ++f) {
+    for (int c = 0; c < 3; ++c) {
+      faces[f][c] = VertexIndex(mesh.face(f)[c].value());
+    }
+  }
+  return faces;
+}
+
+// Times CornerTable::Init on |faces| and checks every table against the
+// previous algorithm.
+bool BenchmarkCornerTableInit(
+    const Options &options, const std::string &name,
+    const IndexTypeVector<FaceIndex, CornerTable::FaceType> &faces) {
+  if (name.find(options.filter) == std::string::npos) {
+    return true;
+  }
+  const ReferenceCornerTable reference(faces);
+  return RunBenchmark(options, name, "face", faces.size(),
+                      [&](Stopwatch *stopwatch) {
+                        CornerTable table;
+                        stopwatch->Start();
+                        const bool ok = table.Init(faces);
+                        stopwatch->Stop();
+                        return ok && reference.Matches(table);
+                      });
+}
+
+// Runs CornerTable::Init on the grid, on the grid with shuffled vertex ids,
+// on the cad mesh with its fins and shared walls, and on the grid with added
+// mirrored, duplicate and degenerate faces.
+bool BenchmarkCornerTableInit(const Options &options, const GridMesh &grid,
+                              const Mesh &cad_mesh) {
+  std::mt19937 generator(7);
+  std::vector<uint32_t> new_ids(grid.grid_size * grid.grid_size);
+  for (uint32_t i = 0; i < new_ids.size(); ++i) {
+    new_ids[i] = i;
+  }
+  std::shuffle(new_ids.begin(), new_ids.end(), generator);
+  IndexTypeVector<FaceIndex, CornerTable::FaceType> shuffled_faces(
+      grid.faces.size());
+  IndexTypeVector<FaceIndex, CornerTable::FaceType> special_faces =
+      grid.faces;
+  for (FaceIndex f(0); f < grid.faces.size(); ++f) {
+    const CornerTable::FaceType &face = grid.faces[f];
+    for (int c = 0; c < 3; ++c) {
+      shuffled_faces[f][c] = VertexIndex(new_ids[face[c].value()]);
+    }
+    if (f.value() % 7 == 0) {
+      special_faces.push_back({{face[0], face[2], face[1]}});
+    }
+    if (f.value() % 11 == 0) {
+      special_faces.push_back(face);
+    }
+    if (f.value() % 13 == 0) {
+      special_faces.push_back({{face[0], face[0], face[1]}});
+    }
+  }
+  return BenchmarkCornerTableInit(options, "CornerTable::Init", grid.faces) &&
+         BenchmarkCornerTableInit(options,
+                                  "CornerTable::Init (shuffled vertices)",
+                                  shuffled_faces) &&
+         BenchmarkCornerTableInit(options, "CornerTable::Init (cad)",
+                                  GetFaces(cad_mesh)) &&
+         BenchmarkCornerTableInit(
+             options, "CornerTable::Init (mirrored, duplicate, degenerate)",
+             special_faces);
+}
+
+bool BenchmarkInverseTransform(const Options &options, const std::string &name,
+                               draco::AttributeTransform *transform,
+                               const PointAttribute &attribute) {
+  std::unique_ptr<PointAttribute> portable =
+      transform->InitTransformedAttribute(attribute, attribute.size());
+  if (!transform->TransformAttribute(attribute, {}, portable.get())) {
+    return false;
+  }
+  PointAttribute target;
+  target.Init(attribute.attribute_type(), attribute.num_components(),
+              draco::DT_FLOAT32, false, attribute.size());
+  return RunBenchmark(options, name, "value", attribute.size(),
+                      [&](Stopwatch *stopwatch) {
+                        stopwatch->Start();
+                        const bool ok = transform->InverseTransformAttribute(
+                            *portable, &target);
+                        stopwatch->Stop();
+                        return ok;
+                      });
+}
+
+// Portable (integer) attributes of the grid together with the connectivity
+// data needed by the mesh prediction schemes. Attribute values are ordered
+// the same way as vertices.
+struct PredictionInput {
+  PredictionInput(const GridMesh &grid);
+
+  std::unique_ptr<CornerTable> corner_table;
+  std::vector<CornerIndex> data_to_corner_map;
+  std::vector<int32_t> vertex_to_data_map;
+  std::vector<PointIndex> entry_to_point_id_map;
+  draco::MeshPredictionSchemeData<CornerTable> mesh_data;
+  std::unique_ptr<PointAttribute> positions;
+  std::unique_ptr<PointAttribute> normals;
+  std::unique_ptr<PointAttribute> tex_coords;
+  int normal_quantization_bits;
+};
+
+PredictionInput::PredictionInput(const GridMesh &grid)
+    : normal_quantization_bits(10) {
+  corner_table = CornerTable::Create(grid.faces);
+  const int num_vertices = corner_table->num_vertices();
+  data_to_corner_map.resize(num_vertices);
+  vertex_to_data_map.resize(num_vertices);
+  entry_to_point_id_map.resize(num_vertices);
+  for (int v = 0; v < num_vertices; ++v) {
+    data_to_corner_map[v] = corner_table->LeftMostCorner(VertexIndex(v));
+    vertex_to_data_map[v] = v;
+    entry_to_point_id_map[v] = PointIndex(v);
+  }
+  mesh_data.Set(&grid.mesh, corner_table.get(), &data_to_corner_map,
+                &vertex_to_data_map);
+
+  const PointAttribute &pos_att = *grid.mesh.attribute(grid.position_att_id);
+  draco::AttributeQuantizationTransform pos_transform;
+  pos_transform.ComputeParameters(pos_att, 14);
+  positions = pos_transform.InitTransformedAttribute(pos_att, num_vertices);
+  pos_transform.TransformAttribute(pos_att, {}, positions.get());
+
+  const PointAttribute &tex_att = *grid.mesh.attribute(grid.tex_coord_att_id);
+  draco::AttributeQuantizationTransform tex_transform;
+  tex_transform.ComputeParameters(tex_att, 12);
+  tex_coords = tex_transform.InitTransformedAttribute(tex_att, num_vertices);
+  tex_transform.TransformAttribute(tex_att, {}, tex_coords.get());
+
+  const PointAttribute &normal_att = *grid.mesh.attribute(grid.normal_att_id);
+  draco::AttributeOctahedronTransform normal_transform;
+  normal_transform.SetParameters(normal_quantization_bits);
+  normals = normal_transform.InitTransformedAttribute(normal_att, num_vertices);
+  normal_transform.TransformAttribute(normal_att, {}, normals.get());
+}
+
+const int32_t *PortableData(const PointAttribute &attribute) {
+  return reinterpret_cast<const int32_t *>(
+      attribute.GetAddress(AttributeValueIndex(0)));
+}
+
+typedef draco::PredictionSchemeTypedEncoderInterface<int32_t> SchemeEncoder;
+typedef draco::PredictionSchemeTypedDecoderInterface<int32_t> SchemeDecoder;
+
+// Encodes |attribute| with |encoder| and benchmarks
+// ComputeOriginalValues() of decoders created by |create_decoder|. The
+// prediction data of the decoder is decoded before the timed call.
+bool BenchmarkPredictionScheme(
+    const Options &options, const std::string &name,
+    const PredictionInput &input, const PointAttribute &attribute,
+    SchemeEncoder *encoder,
+    const std::function<std::unique_ptr<SchemeDecoder>()> &create_decoder) {
+  const int num_components = attribute.num_components();
+  const int num_entries = static_cast<int>(attribute.size()) * num_components;
+  const int32_t *const values = PortableData(attribute);
+  if (encoder->GetNumParentAttributes() > 0 &&
+      !encoder->SetParentAttribute(input.positions.get())) {
+    return false;
+  }
+  std::vector<int32_t> corrections(num_entries);
+  if (!encoder->ComputeCorrectionValues(values, corrections.data(), num_entries,
+                                        num_components,
+                                        input.entry_to_point_id_map.data())) {
+    return false;
+  }
+  EncoderBuffer prediction_data;
+  if (!encoder->EncodePredictionData(&prediction_data)) {
+    return false;
+  }
+  std::vector<int32_t> decoded(num_entries);
+  return RunBenchmark(
+      options, name, "value", attribute.size(), [&](Stopwatch *stopwatch) {
+        std::unique_ptr<SchemeDecoder> decoder = create_decoder();
+        if (decoder->GetNumParentAttributes() > 0 &&
+            !decoder->SetParentAttribute(input.positions.get())) {
+          return false;
+        }
+        DecoderBuffer buffer;
+        InitDecoderBuffer(prediction_data, &buffer);
+        if (!decoder->DecodePredictionData(&buffer)) {
+          return false;
+        }
+        stopwatch->Start();
+        const bool ok = decoder->ComputeOriginalValues(
+            corrections.data(), decoded.data(), num_entries, num_components,
+            input.entry_to_point_id_map.data());
+        stopwatch->Stop();
+        return ok && memcmp(decoded.data(), values,
+                            num_entries * sizeof(int32_t)) == 0;
+      });
+}
+
+bool BenchmarkPredictionSchemes(const Options &options,
+                                const PredictionInput &input) {
+  typedef draco::PredictionSchemeWrapEncodingTransform<int32_t> WrapEncoding;
+  typedef draco::PredictionSchemeWrapDecodingTransform<int32_t> WrapDecoding;
+  typedef draco::MeshPredictionSchemeData<CornerTable> MeshData;
+  const PointAttribute *const positions = input.positions.get();
+  const PointAttribute *const tex_coords = input.tex_coords.get();
+  const PointAttribute *const normals = input.normals.get();
+  const MeshData &mesh_data = input.mesh_data;
+
+  draco::PredictionSchemeDeltaEncoder<int32_t, WrapEncoding> delta_encoder(
+      positions, WrapEncoding());
+  if (!BenchmarkPredictionScheme(
+          options, "PredictionSchemeDeltaDecoder", input, *positions,
+          &delta_encoder, [&]() {
+            return std::unique_ptr<SchemeDecoder>(
+                new draco::PredictionSchemeDeltaDecoder<int32_t, WrapDecoding>(
+                    positions, WrapDecoding()));
+          })) {
+    return false;
+  }
+
+  draco::MeshPredictionSchemeParallelogramEncoder<int32_t, WrapEncoding,
+                                                  MeshData>
+      parallelogram_encoder(positions, WrapEncoding(), mesh_data);
+  if (!BenchmarkPredictionScheme(
+          options, "MeshPredictionSchemeParallelogramDecoder", input,
+          *positions, &parallelogram_encoder, [&]() {
+            return std::unique_ptr<SchemeDecoder>(
+                new draco::MeshPredictionSchemeParallelogramDecoder<
+                    int32_t, WrapDecoding, MeshData>(positions, WrapDecoding(),
+                                                     mesh_data));
+          })) {
+    return false;
+  }
+
+#ifdef DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED
+  draco::MeshPredictionSchemeMultiParallelogramEncoder<int32_t, WrapEncoding,
+                                                       MeshData>
+      multi_parallelogram_encoder(positions, WrapEncoding(), mesh_data);
+  if (!BenchmarkPredictionScheme(
+          options, "MeshPredictionSchemeMultiParallelogramDecoder", input,
+          *positions, &multi_parallelogram_encoder, [&]() {
+            return std::unique_ptr<SchemeDecoder>(
+                new draco::MeshPredictionSchemeMultiParallelogramDecoder<
+                    int32_t, WrapDecoding, MeshData>(positions, WrapDecoding(),
+                                                     mesh_data));
+          })) {
+    return false;
+  }
+#endif
+
+  draco::MeshPredictionSchemeConstrainedMultiParallelogramEncoder<
+      int32_t, WrapEncoding, MeshData>
+      constrained_encoder(positions, WrapEncoding(), mesh_data);
+  if (!BenchmarkPredictionScheme(
+          options, "MeshPredictionSchemeConstrainedMultiParallelogramDecoder",
+          input, *positions, &constrained_encoder, [&]() {
+            return std::unique_ptr<SchemeDecoder>(
+                new draco::MeshPredictionSchemeConstrainedMultiParallelogramDecoder<
+                    int32_t, WrapDecoding, MeshData>(positions, WrapDecoding(),
+                                                     mesh_data));
+          })) {
+    return false;
+  }
+
+  draco::MeshPredictionSchemeTexCoordsPortableEncoder<int32_t, WrapEncoding,
+                                                      MeshData>
+      tex_coords_encoder(tex_coords, WrapEncoding(), mesh_data);
+  if (!BenchmarkPredictionScheme(
+          options, "MeshPredictionSchemeTexCoordsPortableDecoder", input,
+          *tex_coords, &tex_coords_encoder, [&]() {
+            return std::unique_ptr<SchemeDecoder>(
+                new draco::MeshPredictionSchemeTexCoordsPortableDecoder<
+                    int32_t, WrapDecoding, MeshData>(
+                    tex_coords, WrapDecoding(), mesh_data));
+          })) {
+    return false;
+  }
+
+  typedef draco::PredictionSchemeNormalOctahedronCanonicalizedEncodingTransform<
+      int32_t>
+      NormalEncoding;
+  typedef draco::PredictionSchemeNormalOctahedronCanonicalizedDecodingTransform<
+      int32_t>
+      NormalDecoding;
+  const int32_t max_normal_value = (1 << input.normal_quantization_bits) - 1;
+  draco::MeshPredictionSchemeGeometricNormalEncoder<int32_t, NormalEncoding,
+                                                    MeshData>
+      normal_encoder(normals, NormalEncoding(max_normal_value), mesh_data);
+  return BenchmarkPredictionScheme(
+      options, "MeshPredictionSchemeGeometricNormalDecoder", input, *normals,
+      &normal_encoder, [&]() {
+        return std::unique_ptr<SchemeDecoder>(
+            new draco::MeshPredictionSchemeGeometricNormalDecoder<
+                int32_t, NormalDecoding, MeshData>(normals, NormalDecoding(),
+                                                   mesh_data));
+      });
+}
+
+// Mesh decoder that measures the time spent in DecodeConnectivity() and skips
+// decoding of the attributes.
+template <class MeshDecoderT>
+class ConnectivityBenchmarkDecoder : public MeshDecoderT {
+ public:
+  explicit ConnectivityBenchmarkDecoder(Stopwatch *stopwatch)
+      : stopwatch_(stopwatch) {}
+
+ protected:
+  bool DecodeConnectivity() override {
+    stopwatch_->Start();
+    const bool ok = MeshDecoderT::DecodeConnectivity();
+    stopwatch_->Stop();
+    return ok;
+  }
+  bool DecodePointAttributes() override { return true; }
+
+ private:
+  Stopwatch *const stopwatch_;
+};
+
+template <class MeshDecoderT>
+bool BenchmarkConnectivityDecoding(const Options &options,
+                                   const std::string &name,
+                                   const Mesh &input_mesh,
+                                   int encoding_method,
+                                   int edgebreaker_method) {
+  draco::Encoder encoder;
+  encoder.SetAttributeQuantization(GeometryAttribute::POSITION, 14);
+  encoder.SetEncodingMethod(encoding_method);
+  if (edgebreaker_method >= 0) {
+    encoder.options().SetGlobalInt("edgebreaker_method", edgebreaker_method);
+  }
+  EncoderBuffer encoder_buffer;
+  if (!encoder.EncodeMeshToBuffer(input_mesh, &encoder_buffer).ok()) {
+    return false;
+  }
+  const draco::DecoderOptions decoder_options;
+  return RunBenchmark(options, name, "face", input_mesh.num_faces(),
+                      [&](Stopwatch *stopwatch) {
+                        DecoderBuffer buffer;
+                        buffer.Init(encoder_buffer.data(),
+                                    encoder_buffer.size());
+                        ConnectivityBenchmarkDecoder<MeshDecoderT> decoder(
+                            stopwatch);
+                        Mesh mesh;
+                        if (!decoder.Decode(decoder_options, &buffer, &mesh)
+                                 .ok()) {
+                          return false;
+                        }
+                        return mesh.num_faces() == input_mesh.num_faces();
+                      });
+}
+
+// Random points in a flat box like an aerial scan, with quantized positions.
+std::unique_ptr<draco::PointCloud> CreatePointCloud(int num_points) {
+  std::mt19937 generator(11);
+  std::uniform_real_distribution<float> coordinate(-100.f, 100.f);
+  draco::PointCloudBuilder builder;
+  builder.Start(num_points);
+  const int att_id = builder.AddAttribute(GeometryAttribute::POSITION, 3,
+                                          draco::DT_FLOAT32);
+  for (int i = 0; i < num_points; ++i) {
+    const float position[3] = {coordinate(generator), coordinate(generator),
+                               0.1f * coordinate(generator)};
+    builder.SetAttributeValueForPoint(att_id, PointIndex(i), position);
+  }
+  return builder.Finalize(false);
+}
+
+// Returns the coordinates of every point along |axis| in increasing order.
+std::vector<float> SortedCoordinates(const PointAttribute &positions,
+                                     int num_points, int axis) {
+  std::vector<float> coordinates(num_points);
+  for (int i = 0; i < num_points; ++i) {
+    float position[3];
+    positions.GetMappedValue(PointIndex(i), position);
+    coordinates[i] = position[axis];
+  }
+  std::sort(coordinates.begin(), coordinates.end());
+  return coordinates;
+}
+
+// Decodes a point cloud encoded with the kd-tree method, which uses the
+// DynamicIntegerPointsKdTreeDecoder for the quantized positions. The points
+// come back in another order, so the decoded coordinates are compared to the
+// input axis by axis after sorting, which keeps any error within one
+// quantization step.
+bool BenchmarkPointCloudDecoding(const Options &options) {
+  const int kPositionBits = 14;
+  const float max_error = 200.f / ((1 << kPositionBits) - 1);
+  std::unique_ptr<draco::PointCloud> input;
+  std::vector<float> sorted_input[3];
+  for (const int speed : {0, 6}) {
+    const std::string name =
+        "DecodePointCloudFromBuffer (kd-tree, speed " + std::to_string(speed) +
+        ")";
+    if (name.find(options.filter) == std::string::npos) {
+      continue;
+    }
+    if (!input) {
+      input = CreatePointCloud(options.num_points);
+      const PointAttribute &positions = *input->attribute(0);
+      for (int axis = 0; axis < 3; ++axis) {
+        sorted_input[axis] =
+            SortedCoordinates(positions, options.num_points, axis);
+      }
+    }
+    draco::Encoder encoder;
+    encoder.SetSpeedOptions(speed, speed);
+    encoder.SetAttributeQuantization(GeometryAttribute::POSITION,
+                                     kPositionBits);
+    encoder.SetEncodingMethod(draco::POINT_CLOUD_KD_TREE_ENCODING);
+    EncoderBuffer encoder_buffer;
+    if (!encoder.EncodePointCloudToBuffer(*input, &encoder_buffer).ok()) {
+      return false;
+    }
+    if (!RunBenchmark(
+            options, name, "point", options.num_points,
+            [&](Stopwatch *stopwatch) {
+              DecoderBuffer buffer;
+              buffer.Init(encoder_buffer.data(), encoder_buffer.size());
+              draco::Decoder decoder;
+              stopwatch->Start();
+              auto status_or = decoder.DecodePointCloudFromBuffer(&buffer);
+              stopwatch->Stop();
+              if (!status_or.ok() ||
+                  status_or.value()->num_points() !=
+                      static_cast<uint32_t>(options.num_points)) {
+                return false;
+              }
+              const PointAttribute *const positions =
+                  status_or.value()->GetNamedAttribute(
+                      GeometryAttribute::POSITION);
+              if (positions == nullptr) {
+                return false;
+              }
+              for (int axis = 0; axis < 3; ++axis) {
+                const std::vector<float> decoded =
+                    SortedCoordinates(*positions, options.num_points, axis);
+                for (int i = 0; i < options.num_points; ++i) {
+                  if (std::fabs(decoded[i] - sorted_input[axis][i]) >
+                      max_error) {
+                    return false;
+                  }
+                }
+              }
+              return true;
+            })) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Encodes |grid| with quantized attributes using |num_threads| threads.
+bool EncodeGrid(const GridMesh &grid, int encoding_method, int num_threads,
+                EncoderBuffer *out_buffer) {
+  draco::Encoder encoder;
+  encoder.SetAttributeQuantization(GeometryAttribute::POSITION, 14);
+  encoder.SetAttributeQuantization(GeometryAttribute::NORMAL, 10);
+  encoder.SetAttributeQuantization(GeometryAttribute::TEX_COORD, 12);
+  encoder.SetEncodingMethod(encoding_method);
+  encoder.SetNumEncodingThreads(num_threads);
+  return encoder.EncodeMeshToBuffer(grid.mesh, out_buffer).ok();
+}
+
+// Encodes |grid| with |num_threads| threads and checks that the output is
+// byte for byte the same as the single threaded |reference|.
+bool BenchmarkParallelEncoding(const Options &options,
+                               const std::string &method_name,
+                               const GridMesh &grid, int encoding_method,
+                               int num_threads,
+                               const EncoderBuffer &reference) {
+  return RunBenchmark(
+      options,
+      "Encoder (" + method_name + ", " + std::to_string(num_threads) +
+          (num_threads == 1 ? " thread)" : " threads)"),
+      "face", grid.faces.size(), [&](Stopwatch *stopwatch) {
+        EncoderBuffer buffer;
+        stopwatch->Start();
+        if (!EncodeGrid(grid, encoding_method, num_threads, &buffer)) {
+          return false;
+        }
+        stopwatch->Stop();
+        return buffer.size() == reference.size() &&
+               memcmp(buffer.data(), reference.data(), buffer.size()) == 0;
+      });
+}
+
+// Encodes the grid with one thread and with all hardware threads. The
+// encoded data must not depend on the number of threads.
+bool BenchmarkEncoding(const Options &options, const GridMesh &grid) {
+  const int max_threads =
+      std::max(2, static_cast<int>(std::thread::hardware_concurrency()));
+  const struct {
+    const char *name;
+    int encoding_method;
+  } methods[] = {
+      {"edgebreaker", draco::MESH_EDGEBREAKER_ENCODING},
+      {"sequential", draco::MESH_SEQUENTIAL_ENCODING},
+  };
+  for (const auto &method : methods) {
+    EncoderBuffer reference;
+    if (!EncodeGrid(grid, method.encoding_method, 1, &reference) ||
+        !BenchmarkParallelEncoding(options, method.name, grid,
+                                   method.encoding_method, 1, reference) ||
+        !BenchmarkParallelEncoding(options, method.name, grid,
+                                   method.encoding_method, max_threads,
+                                   reference)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns true when |a| and |b| hold bit-identical floats. The vector kernels
+// must match the scalar reference exactly, so no tolerance is allowed.
+bool FloatsMatch(const std::vector<float> &a, const std::vector<float> &b) {
+  return a.size() == b.size() &&
+         (a.empty() ||
+          memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0);
+}
+
+// Inputs of the vector kernels together with their expected outputs, which
+// are computed with the code the kernels replace.
+struct VectorKernelInput {
+  explicit VectorKernelInput(int num_values);
+
+  static constexpr int kNumComponents = 3;
+  static constexpr int kOctahedronBits = 10;
+  float min_values[kNumComponents];
+  float delta;
+  std::vector<int32_t> quantized;
+  std::vector<float> dequantized;
+  std::vector<int32_t> octahedral_coords;
+  std::vector<float> unit_vectors;
+  std::vector<float> gather_source;
+  std::vector<uint32_t> gather_indices;
+  std::vector<float> gathered;
+  std::vector<uint16_t> narrow;
+  std::vector<uint32_t> wide;
+  std::vector<uint32_t> symbols;
+  std::vector<int32_t> signed_ints;
+};
+
+VectorKernelInput::VectorKernelInput(int num_values)
+    : min_values{-1.5f, 2.25f, 0.125f},
+      quantized(num_values),
+      dequantized(num_values),
+      octahedral_coords(num_values),
+      unit_vectors(num_values / 2 * 3),
+      gather_source(num_values),
+      gather_indices(num_values / kNumComponents),
+      gathered(num_values),
+      narrow(num_values),
+      wide(num_values),
+      symbols(num_values),
+      signed_ints(num_values) {
+  std::mt19937 generator(7);
+  draco::Dequantizer dequantizer;
+  dequantizer.Init(10.f, (1 << 14) - 1);
+  delta = dequantizer.delta();
+  for (int i = 0; i < num_values; ++i) {
+    quantized[i] = generator() % (1 << 14);
+    dequantized[i] = dequantizer.DequantizeFloat(quantized[i]) +
+                     min_values[i % kNumComponents];
+  }
+
+  draco::OctahedronToolBox octahedron_tool_box;
+  octahedron_tool_box.SetQuantizationBits(kOctahedronBits);
+  for (int i = 0; i < num_values; ++i) {
+    octahedral_coords[i] =
+        generator() % (octahedron_tool_box.max_quantized_value() + 1);
+  }
+  for (int i = 0; i < num_values / 2; ++i) {
+    octahedron_tool_box.QuantizedOctahedralCoordsToUnitVector(
+        octahedral_coords[2 * i], octahedral_coords[2 * i + 1],
+        &unit_vectors[3 * i]);
+  }
+
+  std::uniform_real_distribution<float> distribution(-100.f, 100.f);
+  for (int i = 0; i < num_values; ++i) {
+    gather_source[i] = distribution(generator);
+  }
+  const int num_entries = num_values / kNumComponents;
+  for (int i = 0; i < num_entries; ++i) {
+    gather_indices[i] = generator() % num_entries;
+    memcpy(&gathered[i * kNumComponents],
+           &gather_source[gather_indices[i] * kNumComponents],
+           sizeof(float) * kNumComponents);
+  }
+
+  for (int i = 0; i < num_values; ++i) {
+    narrow[i] = static_cast<uint16_t>(generator());
+    wide[i] = narrow[i];
+    symbols[i] = generator();
+    signed_ints[i] = draco::ConvertSymbolToSignedInt(symbols[i]);
+  }
+}
+
+// Runs the kernels of every instruction set supported by the CPU and checks
+// that they return the same values as the code they replace.
+bool BenchmarkVectorKernels(const Options &options) {
+  // Divisible by the number of components of all kernels.
+  const int num_values = options.num_values - options.num_values % 6;
+  const VectorKernelInput input(num_values);
+  const int num_points = num_values / 2;
+  const int num_entries = num_values / VectorKernelInput::kNumComponents;
+  for (int level = 0; level < draco::NUM_CPU_LEVELS; ++level) {
+    const draco::VectorKernels *const kernels =
+        draco::GetVectorKernels(static_cast<draco::CpuLevel>(level));
+    if (kernels == nullptr) {
+      continue;
+    }
+    const std::string suffix =
+        std::string(" (") + draco::CpuLevelName(kernels->level) + ")";
+    std::vector<float> floats;
+    std::vector<uint32_t> uints;
+    std::vector<int32_t> ints;
+    if (!RunBenchmark(options, "VectorKernels::DequantizeFloats" + suffix,
+                      "value", num_values,
+                      [&](Stopwatch *stopwatch) {
+                        floats.assign(num_values, 0.f);
+                        stopwatch->Start();
+                        kernels->dequantize_floats(
+                            input.quantized.data(), num_values,
+                            VectorKernelInput::kNumComponents,
+                            input.min_values, input.delta, floats.data());
+                        stopwatch->Stop();
+                        return FloatsMatch(floats, input.dequantized);
+                      }) ||
+        !RunBenchmark(options,
+                      "VectorKernels::OctahedralToUnitVectors" + suffix,
+                      "point", num_points,
+                      [&](Stopwatch *stopwatch) {
+                        floats.assign(num_points * 3, 0.f);
+                        draco::OctahedronToolBox octahedron_tool_box;
+                        octahedron_tool_box.SetQuantizationBits(
+                            VectorKernelInput::kOctahedronBits);
+                        stopwatch->Start();
+                        kernels->octahedral_to_unit_vectors(
+                            input.octahedral_coords.data(), num_points,
+                            octahedron_tool_box.dequantization_scale(),
+                            floats.data());
+                        stopwatch->Stop();
+                        return FloatsMatch(floats, input.unit_vectors);
+                      }) ||
+        !RunBenchmark(options, "VectorKernels::GatherFloats" + suffix,
+                      "point", num_entries,
+                      [&](Stopwatch *stopwatch) {
+                        floats.assign(num_values, 0.f);
+                        stopwatch->Start();
+                        kernels->gather_floats(
+                            input.gather_source.data(),
+                            input.gather_indices.data(), num_entries,
+                            VectorKernelInput::kNumComponents, floats.data());
+                        stopwatch->Stop();
+                        return floats == input.gathered;
+                      }) ||
+        !RunBenchmark(options, "VectorKernels::WidenUint16" + suffix, "value",
+                      num_values,
+                      [&](Stopwatch *stopwatch) {
+                        uints.assign(num_values, 0);
+                        stopwatch->Start();
+                        kernels->widen_uint16(input.narrow.data(), num_values,
+                                              uints.data());
+                        stopwatch->Stop();
+                        return uints == input.wide;
+                      }) ||
+        !RunBenchmark(options, "VectorKernels::SymbolsToSignedInts" + suffix,
+                      "value", num_values, [&](Stopwatch *stopwatch) {
+                        ints.assign(num_values, 0);
+                        stopwatch->Start();
+                        kernels->symbols_to_signed_ints(
+                            input.symbols.data(), num_values, ints.data());
+                        stopwatch->Stop();
+                        return ints == input.signed_ints;
+                      })) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int RunBenchmarks(const Options &options) {
+  printf("Entropy coding\n");
+  if (!BenchmarkSymbolDecoding(options, draco::SYMBOL_CODING_TAGGED,
+                               "DecodeSymbols (tagged)") ||
+      !BenchmarkSymbolDecoding(options, draco::SYMBOL_CODING_RAW,
+                               "DecodeSymbols (RAnsSymbolDecoder)") ||
+      !BenchmarkBitDecoding<draco::RAnsBitEncoder, draco::RAnsBitDecoder>(
+          options, "RAnsBitDecoder") ||
+      !BenchmarkBitDecoding<draco::AdaptiveRAnsBitEncoder,
+                            draco::AdaptiveRAnsBitDecoder>(
+          options, "AdaptiveRAnsBitDecoder") ||
+      !BenchmarkGetBits(options) || !BenchmarkVarintDecoding(options)) {
+    return -1;
+  }
+
+  const GridMesh grid(options.grid_size);
+  printf("Attribute transforms\n");
+  draco::AttributeQuantizationTransform quantization_transform;
+  const PointAttribute &positions = *grid.mesh.attribute(grid.position_att_id);
+  quantization_transform.ComputeParameters(positions, 14);
+  draco::AttributeOctahedronTransform octahedron_transform;
+  octahedron_transform.SetParameters(10);
+  if (!BenchmarkInverseTransform(
+          options, "AttributeQuantizationTransform::Inverse",
+          &quantization_transform, positions) ||
+      !BenchmarkInverseTransform(options,
+                                 "AttributeOctahedronTransform::Inverse",
+                                 &octahedron_transform,
+                                 *grid.mesh.attribute(grid.normal_att_id))) {
+    return -1;
+  }
+
+  printf("Vector kernels (using %s)\n",
+         draco::CpuLevelName(draco::GetVectorKernels().level));
+  if (!BenchmarkVectorKernels(options)) {
+    return -1;
+  }
+
+  printf("Prediction schemes\n");
+  const PredictionInput prediction_input(grid);
+  if (!BenchmarkPredictionSchemes(options, prediction_input)) {
+    return -1;
+  }
+
+  printf("Connectivity\n");
+  // About as many faces as the grid, but with many topology splits.
+  const CadMesh cad(options.grid_size / 4 + 1);
+  if (!BenchmarkCornerTableInit(options, grid, cad.mesh) ||
+      !BenchmarkConnectivityDecoding<draco::MeshEdgebreakerDecoder>(
+          options, "MeshEdgebreakerDecoder (standard)", grid.mesh,
+          draco::MESH_EDGEBREAKER_ENCODING,
+          draco::MESH_EDGEBREAKER_STANDARD_ENCODING) ||
+      !BenchmarkConnectivityDecoding<draco::MeshEdgebreakerDecoder>(
+          options, "MeshEdgebreakerDecoder (valence)", grid.mesh,
+          draco::MESH_EDGEBREAKER_ENCODING,
+          draco::MESH_EDGEBREAKER_VALENCE_ENCODING) ||
+      !BenchmarkConnectivityDecoding<draco::MeshEdgebreakerDecoder>(
+          options, "MeshEdgebreakerDecoder (standard, cad)", cad.mesh,
+          draco::MESH_EDGEBREAKER_ENCODING,
+          draco::MESH_EDGEBREAKER_STANDARD_ENCODING) ||
+      !BenchmarkConnectivityDecoding<draco::MeshSequentialDecoder>(
+          options, "MeshSequentialDecoder", grid.mesh,
+          draco::MESH_SEQUENTIAL_ENCODING, -1)) {
+    return -1;
+  }
+
+  printf("Point clouds\n");
+  if (!BenchmarkPointCloudDecoding(options)) {
+    return -1;
+  }
+
+  printf("Encoding\n");
+  if (!BenchmarkEncoding(options, grid)) {
+    return -1;
+  }
+  return 0;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char **argv) {
+  Options options;
+  const int argc_check = argc - 1;
+
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp("-h", argv[i]) || !strcmp("-?", argv[i])) {
+      Usage();
+      return 0;
+    } else if (!strcmp("-filter", argv[i]) && i < argc_check) {
+      options.filter = argv[++i];
+    } else if (!strcmp("-r", argv[i]) && i < argc_check) {
+      options.repetitions = StringToInt(argv[++i]);
+    } else if (!strcmp("-n", argv[i]) && i < argc_check) {
+      options.num_values = StringToInt(argv[++i]);
+    } else if (!strcmp("-grid", argv[i]) && i < argc_check) {
+      options.grid_size = StringToInt(argv[++i]);
+    } else if (!strcmp("-points", argv[i]) && i < argc_check) {
+      options.num_points = StringToInt(argv[++i]);
+    }
+  }
+  if (options.repetitions < 1 || options.num_values < 3 ||
+      options.grid_size < 2 || options.num_points < 1) {
+    Usage();
+    return -1;
+  }
+  return RunBenchmarks(options);
+}
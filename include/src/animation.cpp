@@ -0,0 +1,189 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "animation.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "draco/animation/keyframe_animation.h"
+#include "draco/animation/keyframe_animation_decoder.h"
+#include "draco/animation/keyframe_animation_encoder.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/encoder_buffer.h"
+
+#define LOG_PREFIX "DracoAnimation | "
+
+struct AnimationEncoder
+{
+    draco::KeyframeAnimation animation;
+    draco::EncoderOptions options = draco::EncoderOptions::CreateDefaultOptions();
+    draco::EncoderBuffer encoderBuffer;
+    uint32_t compressionLevel = 7;
+};
+
+struct AnimationDecoder
+{
+    std::unique_ptr<draco::KeyframeAnimation> animation;
+};
+
+AnimationEncoder *animationEncoderCreate(uint32_t frameCount, const float *timestamps)
+{
+    AnimationEncoder *encoder = new AnimationEncoder;
+    std::vector<draco::KeyframeAnimation::TimestampType> values(timestamps, timestamps + frameCount);
+    if (!encoder->animation.SetTimestamps(values))
+    {
+        delete encoder;
+        return nullptr;
+    }
+    return encoder;
+}
+
+void animationEncoderRelease(AnimationEncoder *encoder)
+{
+    delete encoder;
+}
+
+void animationEncoderSetCompressionLevel(AnimationEncoder *encoder, uint32_t compressionLevel)
+{
+    encoder->compressionLevel = compressionLevel;
+}
+
+int32_t animationEncoderAddTrack(AnimationEncoder *encoder, uint32_t componentCount, const float *data, uint32_t quantizationBits)
+{
+    const size_t valueCount = static_cast<size_t>(encoder->animation.num_frames()) * componentCount;
+    std::vector<float> values(data, data + valueCount);
+    const int32_t trackId = encoder->animation.AddKeyframes(draco::DT_FLOAT32, componentCount, values);
+    if (trackId >= 0 && quantizationBits > 0)
+    {
+        encoder->options.SetAttributeInt(trackId, "quantization_bits", static_cast<int>(quantizationBits));
+    }
+    return trackId;
+}
+
+bool animationEncoderEncode(AnimationEncoder *encoder)
+{
+    int speed = 10 - static_cast<int>(encoder->compressionLevel);
+    encoder->options.SetSpeed(speed, speed);
+
+    encoder->encoderBuffer.Clear();
+    draco::KeyframeAnimationEncoder dracoEncoder;
+    auto encoderStatus = dracoEncoder.EncodeKeyframeAnimation(encoder->animation, encoder->options, &encoder->encoderBuffer);
+    if (!encoderStatus.ok())
+    {
+        printf(LOG_PREFIX "Error during Draco encoding: %s\n", encoderStatus.error_msg());
+        return false;
+    }
+
+    printf(LOG_PREFIX "Encoded %" PRId32 " frames, %" PRId32 " tracks, encoded size: %zu\n", encoder->animation.num_frames(), encoder->animation.num_animations(), encoder->encoderBuffer.size());
+    return true;
+}
+
+uint64_t animationEncoderGetByteLength(AnimationEncoder *encoder)
+{
+    return encoder->encoderBuffer.size();
+}
+
+void animationEncoderCopy(AnimationEncoder *encoder, void *output)
+{
+    memcpy(output, encoder->encoderBuffer.data(), encoder->encoderBuffer.size());
+}
+
+AnimationDecoder *animationDecoderCreate()
+{
+    return new AnimationDecoder;
+}
+
+void animationDecoderRelease(AnimationDecoder *decoder)
+{
+    delete decoder;
+}
+
+bool animationDecoderDecode(AnimationDecoder *decoder, void *data, size_t byteLength)
+{
+    draco::DecoderBuffer decoderBuffer;
+    decoderBuffer.Init(reinterpret_cast<char *>(data), byteLength);
+
+    decoder->animation = std::make_unique<draco::KeyframeAnimation>();
+    draco::DecoderOptions options;
+    draco::KeyframeAnimationDecoder dracoDecoder;
+    auto decoderStatus = dracoDecoder.Decode(options, &decoderBuffer, decoder->animation.get());
+    if (!decoderStatus.ok())
+    {
+        printf(LOG_PREFIX "Error during Draco decoding: %s\n", decoderStatus.error_msg());
+        decoder->animation.reset();
+        return false;
+    }
+    if (decoder->animation->timestamps() == nullptr)
+    {
+        printf(LOG_PREFIX "Draco animation has no timestamps\n");
+        decoder->animation.reset();
+        return false;
+    }
+    return true;
+}
+
+uint32_t animationDecoderGetFrameCount(AnimationDecoder *decoder)
+{
+    return decoder->animation ? static_cast<uint32_t>(decoder->animation->num_frames()) : 0;
+}
+
+// Converts every frame of the attribute to floats, the attributes are stored one value per frame
+static bool copyFrames(const draco::KeyframeAnimation &animation, const draco::PointAttribute *attribute, float *output)
+{
+    if (attribute == nullptr)
+    {
+        return false;
+    }
+    const int8_t componentCount = attribute->num_components();
+    for (draco::PointIndex i(0); i < static_cast<uint32_t>(animation.num_frames()); ++i)
+    {
+        if (!attribute->ConvertValue<float>(attribute->mapped_index(i), componentCount, output + i.value() * componentCount))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void animationDecoderCopyTimestamps(AnimationDecoder *decoder, float *output)
+{
+    if (decoder->animation)
+    {
+        copyFrames(*decoder->animation, decoder->animation->timestamps(), output);
+    }
+}
+
+uint32_t animationDecoderGetTrackComponentCount(AnimationDecoder *decoder, int32_t trackId)
+{
+    // Id 0 holds the timestamps
+    if (!decoder->animation || trackId <= 0)
+    {
+        return 0;
+    }
+    const draco::PointAttribute *attribute = decoder->animation->keyframes(trackId);
+    return attribute ? static_cast<uint32_t>(attribute->num_components()) : 0;
+}
+
+bool animationDecoderCopyTrack(AnimationDecoder *decoder, int32_t trackId, float *output)
+{
+    if (!decoder->animation || trackId <= 0)
+    {
+        return false;
+    }
+    return copyFrames(*decoder->animation, decoder->animation->keyframes(trackId), output);
+}
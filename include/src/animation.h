@@ -0,0 +1,72 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Encoding and decoding of Draco keyframe animations. An animation is a set of float tracks
+ * sharing the same timestamps, each track stores a fixed number of components per frame.
+ */
+
+#pragma once
+
+#include "common.h"
+
+struct AnimationEncoder;
+
+struct AnimationDecoder;
+
+API(AnimationEncoder *)
+animationEncoderCreate(uint32_t frameCount, const float *timestamps);
+
+API(void)
+animationEncoderRelease(AnimationEncoder *encoder);
+
+API(void)
+animationEncoderSetCompressionLevel(AnimationEncoder *encoder, uint32_t compressionLevel);
+
+// Adds a track of frameCount * componentCount floats. The values are quantized to the given
+// number of bits, 0 stores them losslessly. Returns the id of the track or -1 on failure.
+API(int32_t)
+animationEncoderAddTrack(AnimationEncoder *encoder, uint32_t componentCount, const float *data, uint32_t quantizationBits);
+
+API(bool)
+animationEncoderEncode(AnimationEncoder *encoder);
+
+API(uint64_t)
+animationEncoderGetByteLength(AnimationEncoder *encoder);
+
+API(void)
+animationEncoderCopy(AnimationEncoder *encoder, void *output);
+
+API(AnimationDecoder *)
+animationDecoderCreate();
+
+API(void)
+animationDecoderRelease(AnimationDecoder *decoder);
+
+API(bool)
+animationDecoderDecode(AnimationDecoder *decoder, void *data, size_t byteLength);
+
+API(uint32_t)
+animationDecoderGetFrameCount(AnimationDecoder *decoder);
+
+API(void)
+animationDecoderCopyTimestamps(AnimationDecoder *decoder, float *output);
+
+// Returns 0 when the track id doesn't exist
+API(uint32_t)
+animationDecoderGetTrackComponentCount(AnimationDecoder *decoder, int32_t trackId);
+
+// Copies frameCount * componentCount floats of the track
+API(bool)
+animationDecoderCopyTrack(AnimationDecoder *decoder, int32_t trackId, float *output);
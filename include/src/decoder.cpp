@@ -22,21 +22,37 @@
 #include <memory>
 #include <vector>
 #include <cinttypes>
+#include <cstring>
+#include <iterator>
 
 #include "draco/mesh/mesh.h"
+#include "draco/mesh/mesh_cleanup.h"
+#include "draco/mesh/mesh_lod_generator.h"
+#include "draco/mesh/mesh_stripifier.h"
 #include "draco/core/decoder_buffer.h"
+#include "draco/core/memory_resource.h"
+#include "draco/core/vector_kernels.h"
 #include "draco/compression/decode.h"
 
 #define LOG_PREFIX "DracoDecoder | "
 
+using Buffer = std::vector<uint8_t, draco::ResourceAllocator<uint8_t>>;
+
 struct Decoder
 {
-    std::unique_ptr<draco::Mesh> mesh;
-    std::vector<uint8_t> indexBuffer;
-    std::map<uint32_t, std::vector<uint8_t>> buffers;
+    // Declared before everything allocated through them so that they are destroyed last
+    std::unique_ptr<draco::CountingMemoryResource> memoryStats;
+    std::unique_ptr<draco::ArenaMemoryResource> arena;
+    std::unique_ptr<draco::PointCloud> geometry;
+    draco::Mesh *mesh = nullptr; // Same object as geometry, null when a point cloud was decoded
+    Buffer indexBuffer;
+    std::map<uint32_t, Buffer> buffers;
     draco::DecoderBuffer decoderBuffer;
     uint32_t vertexCount;
     uint32_t indexCount;
+    bool decodeAllAttributes = true;
+    std::vector<uint32_t> attributesToDecode;
+    std::vector<draco::MeshLod> lods;
 };
 
 Decoder *decoderCreate()
@@ -49,28 +65,177 @@ void decoderRelease(Decoder *decoder)
     delete decoder;
 }
 
+// Resource of the attribute and index buffers, which must survive the arena being reset
+static draco::MemoryResource *bufferResource(Decoder *decoder)
+{
+    return decoder->memoryStats ? decoder->memoryStats.get() : draco::GetCurrentMemoryResource();
+}
+
+void decoderSetUseArena(Decoder *decoder, bool useArena)
+{
+    if (useArena && !decoder->arena)
+    {
+        decoder->arena = std::make_unique<draco::ArenaMemoryResource>(decoder->memoryStats.get());
+    }
+    else if (!useArena && decoder->arena && !decoder->geometry)
+    {
+        decoder->arena.reset();
+    }
+}
+
+void decoderSetMemoryStats(Decoder *decoder, bool enabled)
+{
+    if (decoder->geometry || enabled == (decoder->memoryStats != nullptr))
+    {
+        return;
+    }
+    decoder->indexBuffer = Buffer();
+    decoder->buffers.clear();
+    decoder->memoryStats.reset();
+    if (enabled)
+    {
+        decoder->memoryStats = std::make_unique<draco::CountingMemoryResource>(draco::GetCurrentMemoryResource());
+    }
+    // The arena reserves its blocks through the counters
+    if (decoder->arena)
+    {
+        decoder->arena = std::make_unique<draco::ArenaMemoryResource>(decoder->memoryStats.get());
+    }
+}
+
+void decoderGetMemoryStats(Decoder *decoder, uint64_t *allocationCount, uint64_t *allocatedBytes, uint64_t *peakBytes, uint64_t *liveBytes)
+{
+    draco::CountingMemoryResource *stats = decoder->memoryStats.get();
+    *allocationCount = stats ? stats->num_allocations() : 0;
+    *allocatedBytes = stats ? stats->allocated_bytes() : 0;
+    *peakBytes = stats ? stats->peak_bytes() : 0;
+    *liveBytes = stats ? stats->live_bytes() : 0;
+    if (stats)
+    {
+        stats->ResetCounters();
+    }
+}
+
+void decoderSetAttributesToDecode(Decoder *decoder, const uint32_t *uniqueIds, size_t count)
+{
+    decoder->decodeAllAttributes = uniqueIds == nullptr;
+    if (uniqueIds == nullptr)
+    {
+        decoder->attributesToDecode.clear();
+        return;
+    }
+    decoder->attributesToDecode.assign(uniqueIds, uniqueIds + count);
+}
+
 bool decoderDecode(Decoder *decoder, void *data, size_t byteLength)
 {
+    if (decoder->arena)
+    {
+        // The previous geometry is the only thing still living in the arena
+        decoder->geometry.reset();
+        decoder->mesh = nullptr;
+        decoder->arena->Reset();
+    }
+    // All Draco storage created while decoding comes from the arena when one is used
+    draco::MemoryResource *resource = decoder->arena ? decoder->arena.get() : bufferResource(decoder);
+    draco::ScopedMemoryResource scopedResource(resource);
+
     draco::Decoder dracoDecoder;
+    if (!decoder->decodeAllAttributes)
+    {
+        dracoDecoder.SetAttributesToDecode(decoder->attributesToDecode);
+    }
     draco::DecoderBuffer dracoDecoderBuffer;
     dracoDecoderBuffer.Init(reinterpret_cast<char *>(data), byteLength);
 
-    auto decoderStatus = dracoDecoder.DecodeMeshFromBuffer(&dracoDecoderBuffer);
-    if (!decoderStatus.ok())
+    auto typeStatus = draco::Decoder::GetEncodedGeometryType(&dracoDecoderBuffer);
+    if (!typeStatus.ok())
     {
-        printf(LOG_PREFIX "Error during Draco decoding: %s\n", decoderStatus.status().error_msg());
+        printf(LOG_PREFIX "Error during Draco decoding: %s\n", typeStatus.status().error_msg());
         return false;
     }
 
-    decoder->mesh = std::move(decoderStatus).value();
-    decoder->vertexCount = decoder->mesh->num_points();
-    decoder->indexCount = decoder->mesh->num_faces() * 3;
+    if (typeStatus.value() == draco::POINT_CLOUD)
+    {
+        auto decoderStatus = dracoDecoder.DecodePointCloudFromBuffer(&dracoDecoderBuffer);
+        if (!decoderStatus.ok())
+        {
+            printf(LOG_PREFIX "Error during Draco decoding: %s\n", decoderStatus.status().error_msg());
+            return false;
+        }
+
+        decoder->geometry = std::move(decoderStatus).value();
+        decoder->mesh = nullptr;
+        decoder->indexCount = 0;
+    }
+    else
+    {
+        auto decoderStatus = dracoDecoder.DecodeMeshFromBuffer(&dracoDecoderBuffer);
+        if (!decoderStatus.ok())
+        {
+            printf(LOG_PREFIX "Error during Draco decoding: %s\n", decoderStatus.status().error_msg());
+            return false;
+        }
+
+        std::unique_ptr<draco::Mesh> mesh = std::move(decoderStatus).value();
+        decoder->mesh = mesh.get();
+        decoder->geometry = std::move(mesh);
+        decoder->indexCount = decoder->mesh->num_faces() * 3;
+    }
+    decoder->vertexCount = decoder->geometry->num_points();
 
     printf(LOG_PREFIX "Decoded %" PRIu32 " vertices, %" PRIu32 " indices\n", decoder->vertexCount, decoder->indexCount);
 
     return true;
 }
 
+bool decoderCleanup(Decoder *decoder, uint32_t *removedVertexCount, uint32_t *removedFaceCount)
+{
+    *removedVertexCount = 0;
+    *removedFaceCount = 0;
+    if (decoder->geometry == nullptr)
+    {
+        printf(LOG_PREFIX "Nothing decoded to clean up\n");
+        return false;
+    }
+
+    // The cleaned up geometry belongs with the decoded one
+    draco::MemoryResource *resource = decoder->arena ? decoder->arena.get() : bufferResource(decoder);
+    draco::ScopedMemoryResource scopedResource(resource);
+
+    const uint32_t vertexCount = decoder->geometry->num_points();
+    const uint32_t faceCount = decoder->indexCount / 3;
+
+    // Equal values share one entry first, so points with the same entries in every attribute are merged
+    if (!decoder->geometry->DeduplicateAttributeValues())
+    {
+        printf(LOG_PREFIX "Failed to deduplicate attribute values\n");
+        return false;
+    }
+    decoder->geometry->DeduplicatePointIds();
+
+    if (decoder->mesh != nullptr)
+    {
+        const draco::Status status = draco::MeshCleanup::Cleanup(decoder->mesh, draco::MeshCleanupOptions());
+        if (!status.ok())
+        {
+            printf(LOG_PREFIX "Error during mesh cleanup: %s\n", status.error_msg());
+            return false;
+        }
+        decoder->indexCount = decoder->mesh->num_faces() * 3;
+    }
+    decoder->vertexCount = decoder->geometry->num_points();
+
+    *removedVertexCount = vertexCount - decoder->vertexCount;
+    *removedFaceCount = faceCount - decoder->indexCount / 3;
+    return true;
+}
+
+bool decoderIsPointCloud(Decoder *decoder)
+{
+    return decoder->geometry != nullptr && decoder->mesh == nullptr;
+}
+
 uint32_t decoderGetVertexCount(Decoder *decoder)
 {
     return decoder->vertexCount;
@@ -81,15 +246,95 @@ uint32_t decoderGetIndexCount(Decoder *decoder)
     return decoder->indexCount;
 }
 
+int32_t decoderGetAttributeIdByType(Decoder *decoder, char *attributeType, uint32_t index)
+{
+    draco::GeometryAttribute::Type type;
+    if (!strcmp(attributeType, "POSITION"))
+    {
+        type = draco::GeometryAttribute::POSITION;
+    }
+    else if (!strcmp(attributeType, "NORMAL"))
+    {
+        type = draco::GeometryAttribute::NORMAL;
+    }
+    else if (!strcmp(attributeType, "TEXCOORD"))
+    {
+        type = draco::GeometryAttribute::TEX_COORD;
+    }
+    else if (!strcmp(attributeType, "COLOR"))
+    {
+        type = draco::GeometryAttribute::COLOR;
+    }
+    else if (!strcmp(attributeType, "GENERIC"))
+    {
+        type = draco::GeometryAttribute::GENERIC;
+    }
+    else
+    {
+        printf(LOG_PREFIX "Attribute type %s not supported\n", attributeType);
+        return -1;
+    }
+
+    const draco::PointAttribute *attribute = decoder->geometry->GetNamedAttribute(type, static_cast<int>(index));
+    if (attribute == nullptr)
+    {
+        return -1;
+    }
+    return static_cast<int32_t>(attribute->unique_id());
+}
+
+int32_t decoderGetAttributeIdByName(Decoder *decoder, char *attributeName)
+{
+    int32_t attributeId = decoder->geometry->GetAttributeIdByMetadataEntry("name", attributeName);
+    if (attributeId < 0)
+    {
+        return -1;
+    }
+    return static_cast<int32_t>(decoder->geometry->attribute(attributeId)->unique_id());
+}
+
 bool decoderAttributeIsNormalized(Decoder *decoder, uint32_t id)
 {
-    const draco::PointAttribute *attribute = decoder->mesh->GetAttributeByUniqueId(id);
+    const draco::PointAttribute *attribute = decoder->geometry->GetAttributeByUniqueId(id);
     return attribute != nullptr && attribute->normalized();
 }
 
+static bool readFloatAttribute(Decoder *decoder, const draco::PointAttribute *attribute, size_t stride, uint8_t *output)
+{
+    static_assert(sizeof(draco::AttributeValueIndex) == sizeof(uint32_t), "Attribute value indices must be 32 bit");
+
+    const int numComponents = attribute->num_components();
+    if (attribute->data_type() != draco::DT_FLOAT32 || stride != sizeof(float) * numComponents ||
+        attribute->byte_stride() != static_cast<int64_t>(stride) ||
+        attribute->size() * numComponents > static_cast<size_t>(INT32_MAX))
+    {
+        return false;
+    }
+
+    const uint8_t *values = attribute->GetAddress(draco::AttributeValueIndex(0));
+    if (attribute->is_mapping_identity())
+    {
+        if (attribute->size() < decoder->vertexCount)
+        {
+            return false;
+        }
+        memcpy(output, values, stride * decoder->vertexCount);
+        return true;
+    }
+
+    if (attribute->indices_map_size() < decoder->vertexCount)
+    {
+        return false;
+    }
+    draco::GetVectorKernels().gather_floats(reinterpret_cast<const float *>(values),
+        reinterpret_cast<const uint32_t *>(attribute->indices_map_data()), static_cast<int>(decoder->vertexCount),
+        numComponents, reinterpret_cast<float *>(output));
+    return true;
+}
+
 bool decoderReadAttribute(Decoder *decoder, uint32_t id, size_t componentType, char *dataType)
 {
-    const draco::PointAttribute *attribute = decoder->mesh->GetAttributeByUniqueId(id);
+    const draco::PointAttribute *attribute = decoder->geometry->GetAttributeByUniqueId(id);
 
     if (attribute == nullptr)
     {
@@ -99,9 +344,16 @@ bool decoderReadAttribute(Decoder *decoder, uint32_t id, size_t componentType, c
 
     size_t stride = getAttributeStride(componentType, dataType);
 
-    std::vector<uint8_t> decodedData;
+    Buffer decodedData(draco::ResourceAllocator<uint8_t>(bufferResource(decoder)));
     decodedData.resize(stride * decoder->vertexCount);
 
+    // Float attributes already stored in the accessor layout are copied in bulk
+    if (componentType == ComponentType::Float && readFloatAttribute(decoder, attribute, stride, decodedData.data()))
+    {
+        decoder->buffers[id] = std::move(decodedData);
+        return true;
+    }
+
     for (uint32_t i = 0; i < decoder->vertexCount; ++i)
     {
         auto index = attribute->mapped_index(draco::PointIndex(i));
@@ -140,7 +392,7 @@ bool decoderReadAttribute(Decoder *decoder, uint32_t id, size_t componentType, c
         }
     }
 
-    decoder->buffers[id] = decodedData;
+    decoder->buffers[id] = std::move(decodedData);
     return true;
 }
 
@@ -169,7 +421,7 @@ void decoderCopyAttribute(Decoder *decoder, size_t id, void *output)
 template <class T>
 void decodeIndices(Decoder *decoder)
 {
-    std::vector<uint8_t> decodedIndices;
+    Buffer decodedIndices(draco::ResourceAllocator<uint8_t>(bufferResource(decoder)));
     decodedIndices.resize(decoder->indexCount * sizeof(T));
     T *typedView = reinterpret_cast<T *>(decodedIndices.data());
 
@@ -181,11 +433,17 @@ void decodeIndices(Decoder *decoder)
         typedView[faceIndex * 3 + 2] = face[2].value();
     }
 
-    decoder->indexBuffer = decodedIndices;
+    decoder->indexBuffer = std::move(decodedIndices);
 }
 
 bool decoderReadIndices(Decoder *decoder, size_t indexComponentType)
 {
+    if (decoder->mesh == nullptr)
+    {
+        printf(LOG_PREFIX "Point clouds have no indices\n");
+        return false;
+    }
+
     switch (indexComponentType)
     {
     case ComponentType::Byte:
@@ -211,6 +469,112 @@ bool decoderReadIndices(Decoder *decoder, size_t indexComponentType)
     return true;
 }
 
+template <class T>
+void storeTriangleStrips(Decoder *decoder, const std::vector<uint32_t> &strips)
+{
+    Buffer stripIndices(draco::ResourceAllocator<uint8_t>(bufferResource(decoder)));
+    stripIndices.resize(strips.size() * sizeof(T));
+    T *typedView = reinterpret_cast<T *>(stripIndices.data());
+
+    for (size_t i = 0; i < strips.size(); ++i)
+    {
+        typedView[i] = static_cast<T>(strips[i]);
+    }
+
+    decoder->indexBuffer = std::move(stripIndices);
+}
+
+bool decoderReadTriangleStripIndices(Decoder *decoder, size_t indexComponentType)
+{
+    if (decoder->mesh == nullptr)
+    {
+        printf(LOG_PREFIX "Point clouds have no indices\n");
+        return false;
+    }
+
+    // The corner table of the stripifier is temporary like the decoded geometry
+    draco::MemoryResource *resource = decoder->arena ? decoder->arena.get() : bufferResource(decoder);
+    draco::ScopedMemoryResource scopedResource(resource);
+
+    std::vector<uint32_t> strips;
+    strips.reserve(decoder->indexCount);
+    draco::MeshStripifier stripifier;
+    if (!stripifier.GenerateTriangleStripsWithDegenerateTriangles(*decoder->mesh, std::back_inserter(strips)))
+    {
+        printf(LOG_PREFIX "Failed to generate triangle strips\n");
+        return false;
+    }
+
+    switch (indexComponentType)
+    {
+    case ComponentType::Byte:
+        storeTriangleStrips<int8_t>(decoder, strips);
+        break;
+    case ComponentType::UnsignedByte:
+        storeTriangleStrips<uint8_t>(decoder, strips);
+        break;
+    case ComponentType::Short:
+        storeTriangleStrips<int16_t>(decoder, strips);
+        break;
+    case ComponentType::UnsignedShort:
+        storeTriangleStrips<uint16_t>(decoder, strips);
+        break;
+    case ComponentType::UnsignedInt:
+        storeTriangleStrips<uint32_t>(decoder, strips);
+        break;
+    default:
+        printf(LOG_PREFIX "Index component type %zu not supported\n", indexComponentType);
+        return false;
+    }
+
+    return true;
+}
+
+uint32_t decoderGenerateLods(Decoder *decoder, uint32_t maxLevels)
+{
+    decoder->lods.clear();
+    if (decoder->mesh == nullptr)
+    {
+        printf(LOG_PREFIX "Point clouds have no levels of detail\n");
+        return 0;
+    }
+
+    // The collapse state is temporary like the decoded geometry
+    draco::MemoryResource *resource = decoder->arena ? decoder->arena.get() : bufferResource(decoder);
+    draco::ScopedMemoryResource scopedResource(resource);
+
+    draco::MeshLodOptions options;
+    options.max_num_levels = static_cast<int>(maxLevels);
+    const draco::Status status = draco::MeshLodGenerator::Generate(*decoder->mesh, options, &decoder->lods);
+    if (!status.ok())
+    {
+        printf(LOG_PREFIX "Error generating levels of detail: %s\n", status.error_msg());
+        decoder->lods.clear();
+        return 0;
+    }
+
+    return static_cast<uint32_t>(decoder->lods.size());
+}
+
+float decoderGetLodError(Decoder *decoder, uint32_t level)
+{
+    return level < decoder->lods.size() ? decoder->lods[level].error : 0.0f;
+}
+
+uint32_t decoderGetLodIndexCount(Decoder *decoder, uint32_t level)
+{
+    return level < decoder->lods.size() ? static_cast<uint32_t>(decoder->lods[level].indices.size()) : 0;
+}
+
+void decoderCopyLodIndices(Decoder *decoder, uint32_t level, uint32_t *output)
+{
+    if (level < decoder->lods.size())
+    {
+        const std::vector<uint32_t> &indices = decoder->lods[level].indices;
+        memcpy(output, indices.data(), indices.size() * sizeof(uint32_t));
+    }
+}
+
 size_t decoderGetIndicesByteLength(Decoder *decoder)
 {
     return decoder->indexBuffer.size();
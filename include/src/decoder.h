@@ -34,15 +34,52 @@ decoderCreate();
 API(void)
 decoderRelease(Decoder *decoder);
 
+// Decodes into a per-decoder arena released as a whole with the decoder instead of allocating every
+// Draco buffer separately. Must be set before decoding.
+API(void)
+decoderSetUseArena(Decoder *decoder, bool useArena);
+
+// Counts the allocations made for the decoded geometry and the attribute and index buffers (with the
+// arena, its blocks are counted instead of the allocations served from them). Must be set before decoding.
+API(void)
+decoderSetMemoryStats(Decoder *decoder, bool enabled);
+
+// Returns the number and total size of the allocations and the peak of live bytes since the previous
+// call, along with the bytes still live, then restarts the counters so consecutive calls measure
+// consecutive stages. Everything is zero when memory stats are disabled.
+API(void)
+decoderGetMemoryStats(Decoder *decoder, uint64_t *allocationCount, uint64_t *allocatedBytes, uint64_t *peakBytes, uint64_t *liveBytes);
+
+// Restricts decoding to the attributes with the given unique ids, as referenced by the glTF Draco
+// extension. Other attributes are skipped and reported as missing, positions are always decoded.
+// Passing a null list decodes all attributes again.
+API(void)
+decoderSetAttributesToDecode(Decoder *decoder, const uint32_t *uniqueIds, size_t count);
+
 API(bool)
 decoderDecode(Decoder *decoder, void *data, size_t byteLength);
 
+// Welds points whose attribute values are all bit-identical, then removes degenerate and duplicate
+// faces and unused attribute values (faces only exist for meshes). Call after decoding and before
+// reading attributes or indices. Reports how many points and faces were removed.
+API(bool)
+decoderCleanup(Decoder *decoder, uint32_t *removedVertexCount, uint32_t *removedFaceCount);
+
+API(bool)
+decoderIsPointCloud(Decoder *decoder);
+
 API(uint32_t)
 decoderGetVertexCount(Decoder *decoder);
 
 API(uint32_t)
 decoderGetIndexCount(Decoder *decoder);
 
+API(int32_t)
+decoderGetAttributeIdByType(Decoder *decoder, char *attributeType, uint32_t index);
+
+API(int32_t)
+decoderGetAttributeIdByName(Decoder *decoder, char *attributeName);
+
 API(bool)
 decoderAttributeIsNormalized(Decoder *decoder, uint32_t id);
 
@@ -58,6 +95,29 @@ decoderCopyAttribute(Decoder *decoder, size_t id, void *output);
 API(bool)
 decoderReadIndices(Decoder *decoder, size_t indexComponentType);
 
+// Reads the faces as triangle strips joined by degenerate triangles instead of a triangle list, which
+// usually needs fewer indices. The winding of every face is kept. Use decoderGetIndicesByteLength for
+// the number of strip indices.
+API(bool)
+decoderReadTriangleStripIndices(Decoder *decoder, size_t indexComponentType);
+
+// Generates up to maxLevels levels of detail by quadric edge collapse, each with about half the faces
+// of the previous one. Levels only reference the decoded vertices, so the attributes read before stay
+// valid. Call after decoding (and after decoderCleanup when used). Returns the number of levels.
+API(uint32_t)
+decoderGenerateLods(Decoder *decoder, uint32_t maxLevels);
+
+// Largest distance between a level and the decoded surface, in the units of the positions.
+API(float)
+decoderGetLodError(Decoder *decoder, uint32_t level);
+
+API(uint32_t)
+decoderGetLodIndexCount(Decoder *decoder, uint32_t level);
+
+// Copies the triangle list of a level as 32 bit indices.
+API(void)
+decoderCopyLodIndices(Decoder *decoder, uint32_t level, uint32_t *output);
+
 API(size_t)
 decoderGetIndicesByteLength(Decoder *decoder);
 
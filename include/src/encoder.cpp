@@ -19,12 +19,22 @@
 
 #include "encoder.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <chrono>
+#include <cmath>
 #include <memory>
+#include <thread>
 #include <vector>
 
 #include "draco/mesh/mesh.h"
+#include "draco/attributes/attribute_quantization_transform.h"
 #include "draco/core/encoder_buffer.h"
+#include "draco/compression/decode.h"
 #include "draco/compression/encode.h"
+#include "draco/compression/expert_encode.h"
+#include "draco/metadata/geometry_metadata.h"
 
 #define LOG_PREFIX "DracoEncoder | "
 
@@ -36,6 +46,7 @@ struct Encoder
     std::vector<std::unique_ptr<draco::DataBuffer>> buffers;
     draco::EncoderBuffer encoderBuffer;
     uint32_t compressionLevel = 7;
+    int32_t edgebreakerMethod = -1;
     size_t rawSize = 0;
     struct
     {
@@ -45,6 +56,7 @@ struct Encoder
         uint32_t color = 10;
         uint32_t generic = 12;
     } quantization;
+    std::vector<EncoderTuneCandidate> tuneCandidates;
 };
 
 Encoder *encoderCreate(uint32_t vertexCount)
@@ -73,6 +85,11 @@ void encoderSetQuantizationBits(Encoder *encoder, uint32_t position, uint32_t no
     encoder->quantization.generic = generic;
 }
 
+void encoderSetEdgebreakerMethod(Encoder *encoder, int32_t method)
+{
+    encoder->edgebreakerMethod = method;
+}
+
 bool encoderEncode(Encoder *encoder, uint8_t preserveTriangleOrder)
 {
     printf(LOG_PREFIX "Preserve triangle order: %s\n", preserveTriangleOrder ? "yes" : "no");
@@ -88,12 +105,20 @@ bool encoderEncode(Encoder *encoder, uint8_t preserveTriangleOrder)
     dracoEncoder.SetAttributeQuantization(draco::GeometryAttribute::COLOR, encoder->quantization.color);
     dracoEncoder.SetAttributeQuantization(draco::GeometryAttribute::GENERIC, encoder->quantization.generic);
     dracoEncoder.SetTrackEncodedProperties(true);
+    //The output doesn't depend on the number of threads
+    dracoEncoder.SetNumEncodingThreads(static_cast<int>(std::thread::hardware_concurrency()));
 
     if (preserveTriangleOrder)
     {
         dracoEncoder.SetEncodingMethod(draco::MESH_SEQUENTIAL_ENCODING);
     }
+    else if (encoder->edgebreakerMethod >= 0)
+    {
+        dracoEncoder.options().SetGlobalInt("edgebreaker_method", encoder->edgebreakerMethod);
+    }
 
+    //Encoding appends to the buffer, drop the result of a previous call
+    encoder->encoderBuffer.Clear();
     auto encoderStatus = dracoEncoder.EncodeMeshToBuffer(encoder->mesh, &encoder->encoderBuffer);
     if (encoderStatus.ok())
     {
@@ -111,6 +136,315 @@ bool encoderEncode(Encoder *encoder, uint8_t preserveTriangleOrder)
     }
 }
 
+struct QuantizationError
+{
+    float maxError = 0.0f;
+    float rmsError = 0.0f;
+};
+
+// Measures the displacement of every point caused by quantizing all attributes of the given type.
+// Quantization is the only lossy step of the codec, so this is exactly the error the decoder will
+// reproduce, and the maximum displacement bounds the Hausdorff distance to the original mesh.
+static bool measureQuantizationError(const draco::Mesh &mesh, draco::GeometryAttribute::Type type, uint32_t bits, QuantizationError *error)
+{
+    *error = QuantizationError();
+    double squaredErrorSum = 0.0;
+    size_t errorCount = 0;
+    for (int32_t i = 0; i < mesh.NumNamedAttributes(type); i++)
+    {
+        const draco::PointAttribute &attribute = *mesh.GetNamedAttribute(type, i);
+        if (attribute.data_type() != draco::DT_FLOAT32)
+        {
+            continue;
+        }
+
+        draco::AttributeQuantizationTransform transform;
+        if (!transform.ComputeParameters(attribute, static_cast<int>(bits)))
+        {
+            return false;
+        }
+        const int pointCount = static_cast<int>(mesh.num_points());
+        std::unique_ptr<draco::PointAttribute> quantized = transform.InitTransformedAttribute(attribute, pointCount);
+        transform.TransformAttribute(attribute, {}, quantized.get());
+
+        const int componentCount = attribute.num_components();
+        draco::GeometryAttribute dequantizedAttribute;
+        dequantizedAttribute.Init(type, nullptr, componentCount, draco::DT_FLOAT32, false, componentCount * sizeof(float), 0);
+        draco::PointAttribute dequantized(dequantizedAttribute);
+        dequantized.Reset(pointCount);
+        if (!transform.InverseTransformAttribute(*quantized, &dequantized))
+        {
+            return false;
+        }
+
+        std::vector<float> original(componentCount);
+        std::vector<float> decoded(componentCount);
+        for (int p = 0; p < pointCount; p++)
+        {
+            attribute.GetMappedValue(draco::PointIndex(p), original.data());
+            dequantized.GetValue(draco::AttributeValueIndex(p), decoded.data());
+            double squaredDistance = 0.0;
+            for (int c = 0; c < componentCount; c++)
+            {
+                double delta = static_cast<double>(original[c]) - decoded[c];
+                squaredDistance += delta * delta;
+            }
+            error->maxError = std::max(error->maxError, static_cast<float>(std::sqrt(squaredDistance)));
+            squaredErrorSum += squaredDistance;
+        }
+        errorCount += pointCount;
+    }
+    if (errorCount > 0)
+    {
+        error->rmsError = static_cast<float>(std::sqrt(squaredErrorSum / errorCount));
+    }
+    return true;
+}
+
+// Returns the smallest number of bits keeping the quantization error of the attribute type within the limit.
+// The error roughly halves with every bit, so a binary search needs only a handful of measurements.
+static bool findQuantizationBits(const draco::Mesh &mesh, draco::GeometryAttribute::Type type, float maxError, uint32_t *bits, QuantizationError *error)
+{
+    uint32_t low = 1;
+    uint32_t high = 30;
+    if (!measureQuantizationError(mesh, type, high, error) || error->maxError > maxError)
+    {
+        return false;
+    }
+    *bits = high;
+    QuantizationError candidateError;
+    while (low < high)
+    {
+        uint32_t middle = (low + high) / 2;
+        if (!measureQuantizationError(mesh, type, middle, &candidateError))
+        {
+            return false;
+        }
+        if (candidateError.maxError <= maxError)
+        {
+            high = middle;
+            *bits = middle;
+            *error = candidateError;
+        }
+        else
+        {
+            low = middle + 1;
+        }
+    }
+    return true;
+}
+
+struct TuneResult
+{
+    EncoderTuneCandidate report;
+    draco::EncoderBuffer buffer;
+    uint32_t encodedVertices = 0;
+    uint32_t encodedIndices = 0;
+};
+
+static void encodeTuneCandidate(const Encoder *encoder, uint8_t preserveTriangleOrder, TuneResult *result)
+{
+    const draco::Mesh &mesh = encoder->mesh;
+    draco::ExpertEncoder dracoEncoder(mesh);
+
+    int speed = 10 - static_cast<int>(result->report.compressionLevel);
+    dracoEncoder.SetSpeedOptions(speed, speed);
+
+    for (int32_t id = 0; id < mesh.num_attributes(); id++)
+    {
+        uint32_t bits;
+        switch (mesh.attribute(id)->attribute_type())
+        {
+        case draco::GeometryAttribute::POSITION:
+            bits = result->report.positionBits;
+            break;
+        case draco::GeometryAttribute::NORMAL:
+            bits = encoder->quantization.normal;
+            break;
+        case draco::GeometryAttribute::TEX_COORD:
+            bits = result->report.uvBits;
+            break;
+        case draco::GeometryAttribute::COLOR:
+            bits = encoder->quantization.color;
+            break;
+        default:
+            bits = encoder->quantization.generic;
+        }
+        dracoEncoder.SetAttributeQuantization(id, static_cast<int>(bits));
+    }
+    dracoEncoder.SetTrackEncodedProperties(true);
+
+    if (preserveTriangleOrder)
+    {
+        dracoEncoder.SetEncodingMethod(draco::MESH_SEQUENTIAL_ENCODING);
+    }
+    else if (encoder->edgebreakerMethod >= 0)
+    {
+        dracoEncoder.options().SetGlobalInt("edgebreaker_method", encoder->edgebreakerMethod);
+    }
+
+    if (dracoEncoder.EncodeToBuffer(&result->buffer).ok())
+    {
+        result->encodedVertices = static_cast<uint32_t>(dracoEncoder.num_encoded_points());
+        result->encodedIndices = static_cast<uint32_t>(dracoEncoder.num_encoded_faces() * 3);
+        result->report.byteLength = result->buffer.size();
+        result->report.valid = true;
+    }
+}
+
+// Decodes the bitstream twice and returns the faster run to reduce the influence of cold caches.
+static bool measureDecodeTime(const draco::EncoderBuffer &buffer, float *milliseconds)
+{
+    *milliseconds = 0.0f;
+    for (int run = 0; run < 2; run++)
+    {
+        draco::DecoderBuffer decoderBuffer;
+        decoderBuffer.Init(buffer.data(), buffer.size());
+        draco::Decoder decoder;
+        auto start = std::chrono::steady_clock::now();
+        auto statusOrMesh = decoder.DecodeMeshFromBuffer(&decoderBuffer);
+        auto end = std::chrono::steady_clock::now();
+        if (!statusOrMesh.ok())
+        {
+            return false;
+        }
+        float elapsed = std::chrono::duration<float, std::milli>(end - start).count();
+        *milliseconds = run == 0 ? elapsed : std::min(*milliseconds, elapsed);
+    }
+    return true;
+}
+
+bool encoderAutoTune(Encoder *encoder, float maxPositionError, float maxUvError, float maxDecodeMilliseconds, uint8_t preserveTriangleOrder)
+{
+    encoder->tuneCandidates.clear();
+
+    //A non-positive limit keeps the configured number of bits. Otherwise the fewest bits meeting the limit are used,
+    //as more bits only make the bitstream larger.
+    uint32_t positionBits = encoder->quantization.position;
+    QuantizationError positionError;
+    if (maxPositionError > 0.0f)
+    {
+        if (!findQuantizationBits(encoder->mesh, draco::GeometryAttribute::POSITION, maxPositionError, &positionBits, &positionError))
+        {
+            printf(LOG_PREFIX "Position error limit %g cannot be met\n", maxPositionError);
+            return false;
+        }
+    }
+    else
+    {
+        measureQuantizationError(encoder->mesh, draco::GeometryAttribute::POSITION, positionBits, &positionError);
+    }
+
+    uint32_t uvBits = encoder->quantization.uv;
+    QuantizationError uvError;
+    if (maxUvError > 0.0f)
+    {
+        if (!findQuantizationBits(encoder->mesh, draco::GeometryAttribute::TEX_COORD, maxUvError, &uvBits, &uvError))
+        {
+            printf(LOG_PREFIX "UV error limit %g cannot be met\n", maxUvError);
+            return false;
+        }
+    }
+    else
+    {
+        measureQuantizationError(encoder->mesh, draco::GeometryAttribute::TEX_COORD, uvBits, &uvError);
+    }
+
+    //Every compression level is a candidate. The encodes are independent and run in parallel,
+    //the decodes are timed one after another so that they don't compete for the CPU.
+    const uint32_t candidateCount = 11;
+    std::vector<TuneResult> results(candidateCount);
+    for (uint32_t level = 0; level < candidateCount; level++)
+    {
+        EncoderTuneCandidate &report = results[level].report;
+        report = EncoderTuneCandidate();
+        report.compressionLevel = level;
+        report.positionBits = positionBits;
+        report.uvBits = uvBits;
+        report.positionMaxError = positionError.maxError;
+        report.positionRmsError = positionError.rmsError;
+        report.uvMaxError = uvError.maxError;
+    }
+
+    std::atomic<uint32_t> nextCandidate(0);
+    auto worker = [&]()
+    {
+        for (uint32_t index = nextCandidate++; index < candidateCount; index = nextCandidate++)
+        {
+            encodeTuneCandidate(encoder, preserveTriangleOrder, &results[index]);
+        }
+    };
+    uint32_t threadCount = std::min(std::max(std::thread::hardware_concurrency(), 1u), candidateCount);
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < threadCount; i++)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    TuneResult *best = nullptr;
+    for (TuneResult &result : results)
+    {
+        EncoderTuneCandidate &report = result.report;
+        if (report.valid && !measureDecodeTime(result.buffer, &report.decodeMilliseconds))
+        {
+            report.valid = false;
+        }
+        encoder->tuneCandidates.push_back(report);
+        if (!report.valid)
+        {
+            printf(LOG_PREFIX "Candidate level %" PRIu32 " failed\n", report.compressionLevel);
+            continue;
+        }
+        printf(LOG_PREFIX "Candidate level %" PRIu32 ", position bits %" PRIu32 ", uv bits %" PRIu32 ": %" PRIu64 " bytes, position error %g (rms %g), uv error %g, decode %.2f ms\n",
+               report.compressionLevel, report.positionBits, report.uvBits, report.byteLength, report.positionMaxError, report.positionRmsError, report.uvMaxError, report.decodeMilliseconds);
+        if (maxDecodeMilliseconds > 0.0f && report.decodeMilliseconds > maxDecodeMilliseconds)
+        {
+            continue;
+        }
+        if (!best || report.byteLength < best->report.byteLength)
+        {
+            best = &result;
+        }
+    }
+
+    if (!best)
+    {
+        printf(LOG_PREFIX "No candidate meets the decode time budget of %.2f ms\n", maxDecodeMilliseconds);
+        return false;
+    }
+
+    encoder->tuneCandidates[best - results.data()].selected = true;
+    encoder->compressionLevel = best->report.compressionLevel;
+    encoder->quantization.position = best->report.positionBits;
+    encoder->quantization.uv = best->report.uvBits;
+    encoder->encodedVertices = best->encodedVertices;
+    encoder->encodedIndices = best->encodedIndices;
+    encoder->encoderBuffer.Clear();
+    encoder->encoderBuffer.Encode(best->buffer.data(), best->buffer.size());
+    printf(LOG_PREFIX "Selected level %" PRIu32 ": %zu bytes\n", encoder->compressionLevel, encoder->encoderBuffer.size());
+    return true;
+}
+
+uint32_t encoderGetTuneCandidateCount(Encoder *encoder)
+{
+    return static_cast<uint32_t>(encoder->tuneCandidates.size());
+}
+
+bool encoderGetTuneCandidate(Encoder *encoder, uint32_t index, EncoderTuneCandidate *candidate)
+{
+    if (index >= encoder->tuneCandidates.size())
+    {
+        return false;
+    }
+    *candidate = encoder->tuneCandidates[index];
+    return true;
+}
+
 uint32_t encoderGetEncodedVertexCount(Encoder *encoder)
 {
     return encoder->encodedVertices;
@@ -246,3 +580,10 @@ encoderSetAttribute(Encoder *encoder, char *attributeName, size_t componentType,
     encoder->rawSize += count * stride;
     return id;
 }
+
+void encoderSetAttributeName(Encoder *encoder, uint32_t id, char *attributeName)
+{
+    auto metadata = std::make_unique<draco::AttributeMetadata>();
+    metadata->AddEntryString("name", attributeName);
+    encoder->mesh.AddAttributeMetadata(static_cast<int32_t>(id), std::move(metadata));
+}
@@ -28,6 +28,20 @@
 
 struct Encoder;
 
+struct EncoderTuneCandidate
+{
+    uint32_t compressionLevel;
+    uint32_t positionBits;
+    uint32_t uvBits;
+    uint64_t byteLength;
+    float positionMaxError;
+    float positionRmsError;
+    float uvMaxError;
+    float decodeMilliseconds;
+    bool valid;
+    bool selected;
+};
+
 API(Encoder *)
 encoderCreate(uint32_t vertexCount);
 
@@ -40,9 +54,23 @@ encoderSetCompressionLevel(Encoder *encoder, uint32_t compressionLevel);
 API(void)
 encoderSetQuantizationBits(Encoder *encoder, uint32_t position, uint32_t normal, uint32_t uv, uint32_t color, uint32_t generic);
 
+// Forces the Edgebreaker variant (0 standard, 2 valence) instead of picking it from the compression level.
+// A negative value restores the automatic choice. Has no effect when the triangle order is preserved.
+API(void)
+encoderSetEdgebreakerMethod(Encoder *encoder, int32_t method);
+
 API(bool)
 encoderEncode(Encoder *encoder, uint8_t preserveTriangleOrder);
 
+API(bool)
+encoderAutoTune(Encoder *encoder, float maxPositionError, float maxUvError, float maxDecodeMilliseconds, uint8_t preserveTriangleOrder);
+
+API(uint32_t)
+encoderGetTuneCandidateCount(Encoder *encoder);
+
+API(bool)
+encoderGetTuneCandidate(Encoder *encoder, uint32_t index, EncoderTuneCandidate *candidate);
+
 API(uint64_t)
 encoderGetByteLength(Encoder *encoder);
 
@@ -60,3 +88,6 @@ encoderGetEncodedVertexCount(Encoder *encoder);
 
 API(uint32_t)
 encoderGetEncodedIndexCount(Encoder *encoder);
+
+API(void)
+encoderSetAttributeName(Encoder *encoder, uint32_t id, char *attributeName);
@@ -0,0 +1,887 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Generates a reproducible corpus of Draco compressed meshes for benchmarking, without any downloads.
+ *
+ * Every mesh family is generated at several triangle counts from a fixed seed, built through
+ * draco::TriangleSoupMeshBuilder (which welds identical corners) and encoded through the encoder
+ * wrapper with the sequential, standard Edgebreaker and valence Edgebreaker methods at several
+ * quantization levels. Each encoding is written as a .drc file and as a .glb file using the
+ * KHR_draco_mesh_compression extension, and listed in corpus.csv with its encode time in encode_times.csv.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <src/encoder.h>
+
+#include "draco/compression/config/compression_shared.h"
+#include "draco/mesh/mesh.h"
+#include "draco/mesh/triangle_soup_mesh_builder.h"
+
+#define LOG_PREFIX "DracoCorpus | "
+
+namespace
+{
+
+const float Pi = 3.14159265358979f;
+
+struct Vertex
+{
+    float position[3] = {};
+    float normal[3] = {};
+    float uv[2] = {};
+    uint16_t joints[4] = {};
+    float weights[4] = {};
+};
+
+// Indexed geometry in the layout of glTF vertex attributes.
+struct Geometry
+{
+    uint32_t vertexCount = 0;
+    uint32_t jointCount = 0;
+    float jointSpacing = 0.0f;
+    std::vector<uint32_t> indices;
+    std::vector<float> positions;
+    std::vector<float> normals;
+    std::vector<float> uvs;
+    std::vector<uint16_t> joints;
+    std::vector<float> weights;
+};
+
+// Collects triangles with per-corner values. Finalizing the mesh welds all corners with identical
+// values into shared vertices, corners differing in any attribute (e.g. UV seams) stay separate.
+class SoupBuilder
+{
+public:
+    SoupBuilder(uint32_t triangleCount, bool skinned)
+        : triangleCount(triangleCount), skinned(skinned)
+    {
+        builder.Start(static_cast<int>(triangleCount));
+        positionId = builder.AddAttribute(draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32);
+        normalId = builder.AddAttribute(draco::GeometryAttribute::NORMAL, 3, draco::DT_FLOAT32);
+        uvId = builder.AddAttribute(draco::GeometryAttribute::TEX_COORD, 2, draco::DT_FLOAT32);
+        if (skinned)
+        {
+            jointsId = builder.AddAttribute(draco::GeometryAttribute::GENERIC, 4, draco::DT_UINT16);
+            weightsId = builder.AddAttribute(draco::GeometryAttribute::GENERIC, 4, draco::DT_FLOAT32);
+        }
+    }
+
+    void addTriangle(const Vertex &a, const Vertex &b, const Vertex &c)
+    {
+        draco::FaceIndex face(nextTriangle++);
+        builder.SetAttributeValuesForFace(positionId, face, a.position, b.position, c.position);
+        builder.SetAttributeValuesForFace(normalId, face, a.normal, b.normal, c.normal);
+        builder.SetAttributeValuesForFace(uvId, face, a.uv, b.uv, c.uv);
+        if (skinned)
+        {
+            builder.SetAttributeValuesForFace(jointsId, face, a.joints, b.joints, c.joints);
+            builder.SetAttributeValuesForFace(weightsId, face, a.weights, b.weights, c.weights);
+        }
+    }
+
+    void addQuad(const Vertex &a, const Vertex &b, const Vertex &c, const Vertex &d)
+    {
+        addTriangle(a, b, c);
+        addTriangle(a, c, d);
+    }
+
+    bool finalize(Geometry *geometry)
+    {
+        if (nextTriangle != triangleCount)
+        {
+            printf(LOG_PREFIX "Generated %" PRIu32 " of %" PRIu32 " triangles\n", nextTriangle, triangleCount);
+            return false;
+        }
+        std::unique_ptr<draco::Mesh> mesh = builder.Finalize();
+        if (!mesh)
+        {
+            return false;
+        }
+
+        const uint32_t vertexCount = mesh->num_points();
+        geometry->vertexCount = vertexCount;
+        geometry->positions.resize(vertexCount * 3);
+        geometry->normals.resize(vertexCount * 3);
+        geometry->uvs.resize(vertexCount * 2);
+        if (skinned)
+        {
+            geometry->joints.resize(vertexCount * 4);
+            geometry->weights.resize(vertexCount * 4);
+        }
+        for (uint32_t i = 0; i < vertexCount; i++)
+        {
+            draco::PointIndex point(i);
+            mesh->attribute(positionId)->GetMappedValue(point, &geometry->positions[i * 3]);
+            mesh->attribute(normalId)->GetMappedValue(point, &geometry->normals[i * 3]);
+            mesh->attribute(uvId)->GetMappedValue(point, &geometry->uvs[i * 2]);
+            if (skinned)
+            {
+                mesh->attribute(jointsId)->GetMappedValue(point, &geometry->joints[i * 4]);
+                mesh->attribute(weightsId)->GetMappedValue(point, &geometry->weights[i * 4]);
+            }
+        }
+
+        geometry->indices.resize(static_cast<size_t>(triangleCount) * 3);
+        for (uint32_t f = 0; f < triangleCount; f++)
+        {
+            const draco::Mesh::Face &face = mesh->face(draco::FaceIndex(f));
+            for (int c = 0; c < 3; c++)
+            {
+                geometry->indices[f * 3 + c] = face[c].value();
+            }
+        }
+        return true;
+    }
+
+private:
+    draco::TriangleSoupMeshBuilder builder;
+    uint32_t triangleCount;
+    uint32_t nextTriangle = 0;
+    bool skinned;
+    int positionId = -1;
+    int normalId = -1;
+    int uvId = -1;
+    int jointsId = -1;
+    int weightsId = -1;
+};
+
+void setVector(float *out, float x, float y, float z)
+{
+    out[0] = x;
+    out[1] = y;
+    out[2] = z;
+}
+
+void normalize(float *v)
+{
+    float length = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    if (length > 0.0f)
+    {
+        v[0] /= length;
+        v[1] /= length;
+        v[2] /= length;
+    }
+}
+
+// Number of cells along one side of a square patch of cells with the given triangle count each.
+uint32_t cellsPerSide(uint32_t targetTriangles, uint32_t trianglesPerCell)
+{
+    double side = std::sqrt(static_cast<double>(targetTriangles) / trianglesPerCell);
+    return std::max<uint32_t>(1, static_cast<uint32_t>(std::lround(side)));
+}
+
+// Smooth value noise in [-1, 1] interpolated from random values on the integer lattice.
+float latticeValue(int32_t x, int32_t z, uint32_t seed)
+{
+    uint32_t h = seed ^ (static_cast<uint32_t>(x) * 0x8da6b343u) ^ (static_cast<uint32_t>(z) * 0xd8163841u);
+    h = (h ^ (h >> 13)) * 0x85ebca6bu;
+    h ^= h >> 16;
+    return static_cast<float>(h & 0xffffffu) / static_cast<float>(0xffffffu) * 2.0f - 1.0f;
+}
+
+float valueNoise(float x, float z, uint32_t seed)
+{
+    float fx = std::floor(x);
+    float fz = std::floor(z);
+    int32_t ix = static_cast<int32_t>(fx);
+    int32_t iz = static_cast<int32_t>(fz);
+    float tx = x - fx;
+    float tz = z - fz;
+    tx = tx * tx * (3.0f - 2.0f * tx);
+    tz = tz * tz * (3.0f - 2.0f * tz);
+    float a = latticeValue(ix, iz, seed) + (latticeValue(ix + 1, iz, seed) - latticeValue(ix, iz, seed)) * tx;
+    float b = latticeValue(ix, iz + 1, seed) + (latticeValue(ix + 1, iz + 1, seed) - latticeValue(ix, iz + 1, seed)) * tx;
+    return a + (b - a) * tz;
+}
+
+// Fractal sum of noise octaves over a terrain of 100 x 100 units.
+float terrainHeight(float x, float z, uint32_t seed)
+{
+    float height = 0.0f;
+    float amplitude = 12.0f;
+    float frequency = 0.02f;
+    for (uint32_t octave = 0; octave < 6; octave++)
+    {
+        height += amplitude * valueNoise(x * frequency, z * frequency, seed + octave);
+        amplitude *= 0.5f;
+        frequency *= 2.0f;
+    }
+    return height;
+}
+
+// Flat plane with a single UV island.
+bool generateGrid(uint32_t targetTriangles, uint32_t /* seed */, Geometry *geometry)
+{
+    const uint32_t n = cellsPerSide(targetTriangles, 2);
+    SoupBuilder soup(2 * n * n, false);
+    auto vertex = [&](uint32_t x, uint32_t z)
+    {
+        Vertex v;
+        setVector(v.position, 10.0f * x / n, 0.0f, 10.0f * z / n);
+        setVector(v.normal, 0.0f, 1.0f, 0.0f);
+        v.uv[0] = static_cast<float>(x) / n;
+        v.uv[1] = static_cast<float>(z) / n;
+        return v;
+    };
+    for (uint32_t z = 0; z < n; z++)
+    {
+        for (uint32_t x = 0; x < n; x++)
+        {
+            soup.addQuad(vertex(x, z), vertex(x, z + 1), vertex(x + 1, z + 1), vertex(x + 1, z));
+        }
+    }
+    return soup.finalize(geometry);
+}
+
+// Subdivided cube projected onto a sphere. Each cube side is its own UV island of a 3 x 2 atlas, so
+// the cube edges are UV seams.
+bool generateSphere(uint32_t targetTriangles, uint32_t /* seed */, Geometry *geometry)
+{
+    const uint32_t n = cellsPerSide(targetTriangles, 12);
+    SoupBuilder soup(12 * n * n, false);
+    //Axes of the cube sides: normal, u direction and v direction
+    const float sides[6][3][3] = {
+        {{1, 0, 0}, {0, 0, -1}, {0, 1, 0}},
+        {{-1, 0, 0}, {0, 0, 1}, {0, 1, 0}},
+        {{0, 1, 0}, {1, 0, 0}, {0, 0, -1}},
+        {{0, -1, 0}, {1, 0, 0}, {0, 0, 1}},
+        {{0, 0, 1}, {1, 0, 0}, {0, 1, 0}},
+        {{0, 0, -1}, {-1, 0, 0}, {0, 1, 0}},
+    };
+    for (uint32_t side = 0; side < 6; side++)
+    {
+        const float(*axes)[3] = sides[side];
+        auto vertex = [&](uint32_t i, uint32_t j)
+        {
+            //Lattice coordinates are computed identically on all sides so that the points on shared
+            //cube edges are bit-identical and get welded
+            float s = -1.0f + 2.0f * static_cast<float>(i) / static_cast<float>(n);
+            float t = -1.0f + 2.0f * static_cast<float>(j) / static_cast<float>(n);
+            Vertex v;
+            for (int c = 0; c < 3; c++)
+            {
+                v.normal[c] = axes[0][c] + s * axes[1][c] + t * axes[2][c];
+            }
+            normalize(v.normal);
+            setVector(v.position, 5.0f * v.normal[0], 5.0f * v.normal[1], 5.0f * v.normal[2]);
+            v.uv[0] = (static_cast<float>(side % 3) + static_cast<float>(i) / n) / 3.0f;
+            v.uv[1] = (static_cast<float>(side / 3) + static_cast<float>(j) / n) / 2.0f;
+            return v;
+        };
+        for (uint32_t j = 0; j < n; j++)
+        {
+            for (uint32_t i = 0; i < n; i++)
+            {
+                soup.addQuad(vertex(i, j), vertex(i + 1, j), vertex(i + 1, j + 1), vertex(i, j + 1));
+            }
+        }
+    }
+    return soup.finalize(geometry);
+}
+
+// Height field of fractal noise with smooth normals.
+bool generateTerrain(uint32_t targetTriangles, uint32_t seed, Geometry *geometry)
+{
+    const uint32_t n = cellsPerSide(targetTriangles, 2);
+    const float cellSize = 100.0f / n;
+    SoupBuilder soup(2 * n * n, false);
+    std::vector<Vertex> row0(n + 1);
+    std::vector<Vertex> row1(n + 1);
+    auto computeRow = [&](uint32_t z, std::vector<Vertex> *row)
+    {
+        for (uint32_t x = 0; x <= n; x++)
+        {
+            float px = x * cellSize;
+            float pz = z * cellSize;
+            Vertex &v = (*row)[x];
+            setVector(v.position, px, terrainHeight(px, pz, seed), pz);
+            float dx = terrainHeight(px + cellSize, pz, seed) - terrainHeight(px - cellSize, pz, seed);
+            float dz = terrainHeight(px, pz + cellSize, seed) - terrainHeight(px, pz - cellSize, seed);
+            setVector(v.normal, -dx, 2.0f * cellSize, -dz);
+            normalize(v.normal);
+            v.uv[0] = static_cast<float>(x) / n;
+            v.uv[1] = static_cast<float>(z) / n;
+        }
+    };
+    computeRow(0, &row0);
+    for (uint32_t z = 0; z < n; z++)
+    {
+        computeRow(z + 1, &row1);
+        for (uint32_t x = 0; x < n; x++)
+        {
+            soup.addQuad(row0[x], row1[x], row1[x + 1], row0[x + 1]);
+        }
+        row0.swap(row1);
+    }
+    return soup.finalize(geometry);
+}
+
+// Wavy surface cut into UV islands of 2 x 2 quads that are shuffled and rotated in the atlas, so
+// most vertices are split by seams.
+bool generateSeams(uint32_t targetTriangles, uint32_t seed, Geometry *geometry)
+{
+    const uint32_t n = cellsPerSide(targetTriangles, 2);
+    const uint32_t islandsPerSide = (n + 1) / 2;
+    const uint32_t islandCount = islandsPerSide * islandsPerSide;
+    std::mt19937 random(seed);
+    std::vector<uint32_t> atlasSlots(islandCount);
+    std::vector<uint8_t> rotations(islandCount);
+    for (uint32_t i = 0; i < islandCount; i++)
+    {
+        atlasSlots[i] = i;
+        rotations[i] = static_cast<uint8_t>(random() % 4);
+    }
+    std::shuffle(atlasSlots.begin(), atlasSlots.end(), random);
+
+    SoupBuilder soup(2 * n * n, false);
+    auto vertex = [&](uint32_t x, uint32_t z, uint32_t islandX, uint32_t islandZ)
+    {
+        float px = 10.0f * x / n;
+        float pz = 10.0f * z / n;
+        Vertex v;
+        setVector(v.position, px, 0.5f * std::sin(px) * std::cos(pz), pz);
+        setVector(v.normal, -0.5f * std::cos(px) * std::cos(pz), 1.0f, 0.5f * std::sin(px) * std::sin(pz));
+        normalize(v.normal);
+        //Position inside the island in [0, 1], rotated by multiples of 90 degrees
+        uint32_t island = islandZ * islandsPerSide + islandX;
+        float u = static_cast<float>(x - 2 * islandX) / 2.0f;
+        float w = static_cast<float>(z - 2 * islandZ) / 2.0f;
+        for (uint8_t r = 0; r < rotations[island]; r++)
+        {
+            float rotated = 1.0f - w;
+            w = u;
+            u = rotated;
+        }
+        uint32_t slot = atlasSlots[island];
+        v.uv[0] = (static_cast<float>(slot % islandsPerSide) + 0.1f + 0.8f * u) / islandsPerSide;
+        v.uv[1] = (static_cast<float>(slot / islandsPerSide) + 0.1f + 0.8f * w) / islandsPerSide;
+        return v;
+    };
+    for (uint32_t z = 0; z < n; z++)
+    {
+        for (uint32_t x = 0; x < n; x++)
+        {
+            uint32_t ix = x / 2;
+            uint32_t iz = z / 2;
+            soup.addQuad(vertex(x, z, ix, iz), vertex(x, z + 1, ix, iz), vertex(x + 1, z + 1, ix, iz), vertex(x + 1, z, ix, iz));
+        }
+    }
+    return soup.finalize(geometry);
+}
+
+// Open tube along the Y axis skinned to a chain of joints. Every vertex is weighted to the two
+// nearest joints, the UV wrap around the tube is a seam.
+bool generateSkinned(uint32_t targetTriangles, uint32_t /* seed */, Geometry *geometry)
+{
+    const uint32_t jointCount = 8;
+    const float height = 10.0f;
+    const uint32_t segments = std::min<uint32_t>(std::max<uint32_t>(cellsPerSide(targetTriangles, 8), 8), 1024);
+    const uint32_t rings = std::max<uint32_t>(1, static_cast<uint32_t>(std::lround(static_cast<double>(targetTriangles) / (2 * segments))));
+    geometry->jointCount = jointCount;
+    geometry->jointSpacing = height / (jointCount - 1);
+
+    SoupBuilder soup(2 * segments * rings, true);
+    auto vertex = [&](uint32_t segment, uint32_t ring)
+    {
+        float t = static_cast<float>(ring) / rings;
+        float angle = 2.0f * Pi * static_cast<float>(segment % segments) / segments;
+        float radius = 0.5f + 0.1f * std::sin(t * 4.0f * Pi);
+        Vertex v;
+        setVector(v.position, radius * std::cos(angle), t * height, radius * std::sin(angle));
+        setVector(v.normal, std::cos(angle), 0.0f, std::sin(angle));
+        v.uv[0] = static_cast<float>(segment) / segments;
+        v.uv[1] = t;
+        float bone = t * (jointCount - 1);
+        uint32_t joint = std::min<uint32_t>(static_cast<uint32_t>(bone), jointCount - 2);
+        float blend = std::min(bone - static_cast<float>(joint), 1.0f);
+        v.joints[0] = static_cast<uint16_t>(joint);
+        v.joints[1] = static_cast<uint16_t>(joint + 1);
+        v.weights[0] = 1.0f - blend;
+        v.weights[1] = blend;
+        return v;
+    };
+    for (uint32_t ring = 0; ring < rings; ring++)
+    {
+        for (uint32_t segment = 0; segment < segments; segment++)
+        {
+            soup.addQuad(vertex(segment, ring), vertex(segment, ring + 1), vertex(segment + 1, ring + 1), vertex(segment + 1, ring));
+        }
+    }
+    return soup.finalize(geometry);
+}
+
+// Grid of flat shaded boxes of random heights like a CAD export. Neighbouring boxes share side
+// faces and every box has a fin on one of its top edges, which makes many edges non-manifold.
+bool generateCad(uint32_t targetTriangles, uint32_t seed, Geometry *geometry)
+{
+    const uint32_t trianglesPerBox = 14;
+    const uint32_t n = cellsPerSide(targetTriangles, trianglesPerBox);
+    std::mt19937 random(seed);
+    SoupBuilder soup(trianglesPerBox * n * n, false);
+    auto vertex = [](float x, float y, float z, const float *normal, float u, float v)
+    {
+        Vertex result;
+        setVector(result.position, x, y, z);
+        setVector(result.normal, normal[0], normal[1], normal[2]);
+        result.uv[0] = u;
+        result.uv[1] = v;
+        return result;
+    };
+    //Corners of the box sides in units of the box size, with their normals
+    const float sides[6][4][3] = {
+        {{1, 0, 0}, {1, 1, 0}, {1, 1, 1}, {1, 0, 1}},
+        {{0, 0, 1}, {0, 1, 1}, {0, 1, 0}, {0, 0, 0}},
+        {{0, 1, 0}, {0, 1, 1}, {1, 1, 1}, {1, 1, 0}},
+        {{0, 0, 0}, {1, 0, 0}, {1, 0, 1}, {0, 0, 1}},
+        {{0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}},
+        {{1, 0, 0}, {0, 0, 0}, {0, 1, 0}, {1, 1, 0}},
+    };
+    const float normals[6][3] = {{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}};
+    const float uvs[4][2] = {{0, 0}, {0, 1}, {1, 1}, {1, 0}};
+    for (uint32_t z = 0; z < n; z++)
+    {
+        for (uint32_t x = 0; x < n; x++)
+        {
+            float height = static_cast<float>(1 + random() % 3);
+            Vertex corners[4];
+            for (uint32_t side = 0; side < 6; side++)
+            {
+                for (uint32_t c = 0; c < 4; c++)
+                {
+                    const float *p = sides[side][c];
+                    corners[c] = vertex(x + p[0], height * p[1], z + p[2], normals[side], uvs[c][0], uvs[c][1]);
+                }
+                soup.addQuad(corners[0], corners[1], corners[2], corners[3]);
+            }
+            //Vertical fin on the top edge along X, shared with the top and the side faces
+            const float finNormal[3] = {0, 0, 1};
+            float finZ = static_cast<float>(z + random() % 2);
+            soup.addQuad(vertex(x, height, finZ, finNormal, 0, 0), vertex(x + 1.0f, height, finZ, finNormal, 1, 0),
+                         vertex(x + 1.0f, height + 0.5f, finZ, finNormal, 1, 1), vertex(x, height + 0.5f, finZ, finNormal, 0, 1));
+        }
+    }
+    return soup.finalize(geometry);
+}
+
+struct Family
+{
+    const char *name;
+    bool (*generate)(uint32_t targetTriangles, uint32_t seed, Geometry *geometry);
+};
+
+const Family families[] = {
+    {"grid", generateGrid},
+    {"sphere", generateSphere},
+    {"terrain", generateTerrain},
+    {"seams", generateSeams},
+    {"skinned", generateSkinned},
+    {"cad", generateCad},
+};
+
+struct Method
+{
+    const char *name;
+    uint8_t preserveTriangleOrder;
+    int32_t edgebreakerMethod;
+};
+
+const Method methods[] = {
+    {"sequential", 1, -1},
+    {"edgebreaker", 0, draco::MESH_EDGEBREAKER_STANDARD_ENCODING},
+    {"valence", 0, draco::MESH_EDGEBREAKER_VALENCE_ENCODING},
+};
+
+struct Quantization
+{
+    uint32_t position;
+    uint32_t normal;
+    uint32_t uv;
+    uint32_t generic;
+};
+
+const Quantization quantizations[] = {
+    {11, 8, 10, 8},
+    {14, 10, 12, 12},
+    {16, 12, 14, 14},
+};
+
+std::string sizeLabel(uint32_t triangles)
+{
+    if (triangles >= 1000000 && triangles % 1000000 == 0)
+    {
+        return std::to_string(triangles / 1000000) + "m";
+    }
+    if (triangles >= 1000 && triangles % 1000 == 0)
+    {
+        return std::to_string(triangles / 1000) + "k";
+    }
+    return std::to_string(triangles);
+}
+
+void appendFormat(std::string *out, const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+void appendFormat(std::string *out, const char *format, ...)
+{
+    char buffer[512];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    out->append(buffer);
+}
+
+bool writeFile(const std::string &path, const void *data, size_t length)
+{
+    FILE *file = fopen(path.c_str(), "wb");
+    if (!file)
+    {
+        printf(LOG_PREFIX "Cannot write %s\n", path.c_str());
+        return false;
+    }
+    bool ok = fwrite(data, 1, length, file) == length;
+    ok = fclose(file) == 0 && ok;
+    return ok;
+}
+
+struct AttributeIds
+{
+    uint32_t position;
+    uint32_t normal;
+    uint32_t uv;
+    uint32_t joints;
+    uint32_t weights;
+};
+
+// Wraps the Draco bitstream into a binary glTF with a single mesh using KHR_draco_mesh_compression.
+// Skinned meshes also get a chain of joint nodes and their inverse bind matrices.
+bool writeGlb(const std::string &path, const std::string &name, const Geometry &geometry, const AttributeIds &ids,
+              const std::vector<uint8_t> &draco, uint32_t encodedVertices, uint32_t encodedIndices)
+{
+    const bool skinned = geometry.jointCount > 0;
+    float min[3] = {INFINITY, INFINITY, INFINITY};
+    float max[3] = {-INFINITY, -INFINITY, -INFINITY};
+    for (uint32_t i = 0; i < geometry.vertexCount; i++)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            min[c] = std::min(min[c], geometry.positions[i * 3 + c]);
+            max[c] = std::max(max[c], geometry.positions[i * 3 + c]);
+        }
+    }
+
+    std::vector<uint8_t> bin(draco);
+    const size_t matricesOffset = (bin.size() + 3) & ~size_t(3);
+    if (skinned)
+    {
+        //Column-major translations to the rest position of every joint
+        bin.resize(matricesOffset + geometry.jointCount * 16 * sizeof(float));
+        for (uint32_t joint = 0; joint < geometry.jointCount; joint++)
+        {
+            float matrix[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, -geometry.jointSpacing * joint, 0, 1};
+            memcpy(&bin[matricesOffset + joint * sizeof(matrix)], matrix, sizeof(matrix));
+        }
+    }
+    bin.resize((bin.size() + 3) & ~size_t(3), 0);
+
+    std::string json;
+    appendFormat(&json, "{\"asset\":{\"version\":\"2.0\",\"generator\":\"GDDraco corpus generator\"},");
+    appendFormat(&json, "\"extensionsUsed\":[\"KHR_draco_mesh_compression\"],\"extensionsRequired\":[\"KHR_draco_mesh_compression\"],");
+    appendFormat(&json, "\"scene\":0,\"scenes\":[{\"nodes\":[0%s]}],", skinned ? ",1" : "");
+    appendFormat(&json, "\"nodes\":[{\"name\":\"%s\",\"mesh\":0%s}", name.c_str(), skinned ? ",\"skin\":0" : "");
+    for (uint32_t joint = 0; joint < geometry.jointCount; joint++)
+    {
+        appendFormat(&json, ",{\"name\":\"joint_%" PRIu32 "\",\"translation\":[0,%.9g,0]", joint, joint == 0 ? 0.0 : geometry.jointSpacing);
+        if (joint + 1 < geometry.jointCount)
+        {
+            appendFormat(&json, ",\"children\":[%" PRIu32 "]", joint + 2);
+        }
+        appendFormat(&json, "}");
+    }
+    appendFormat(&json, "],");
+
+    appendFormat(&json, "\"meshes\":[{\"name\":\"%s\",\"primitives\":[{\"mode\":4,\"indices\":0,", name.c_str());
+    appendFormat(&json, "\"attributes\":{\"POSITION\":1,\"NORMAL\":2,\"TEXCOORD_0\":3%s},", skinned ? ",\"JOINTS_0\":4,\"WEIGHTS_0\":5" : "");
+    appendFormat(&json, "\"extensions\":{\"KHR_draco_mesh_compression\":{\"bufferView\":0,\"attributes\":{");
+    appendFormat(&json, "\"POSITION\":%" PRIu32 ",\"NORMAL\":%" PRIu32 ",\"TEXCOORD_0\":%" PRIu32, ids.position, ids.normal, ids.uv);
+    if (skinned)
+    {
+        appendFormat(&json, ",\"JOINTS_0\":%" PRIu32 ",\"WEIGHTS_0\":%" PRIu32, ids.joints, ids.weights);
+    }
+    appendFormat(&json, "}}}}]}],");
+
+    appendFormat(&json, "\"accessors\":[{\"componentType\":5125,\"count\":%" PRIu32 ",\"type\":\"SCALAR\"},", encodedIndices);
+    appendFormat(&json, "{\"componentType\":5126,\"count\":%" PRIu32 ",\"type\":\"VEC3\",\"min\":[%.9g,%.9g,%.9g],\"max\":[%.9g,%.9g,%.9g]},",
+                 encodedVertices, min[0], min[1], min[2], max[0], max[1], max[2]);
+    appendFormat(&json, "{\"componentType\":5126,\"count\":%" PRIu32 ",\"type\":\"VEC3\"},", encodedVertices);
+    appendFormat(&json, "{\"componentType\":5126,\"count\":%" PRIu32 ",\"type\":\"VEC2\"}", encodedVertices);
+    if (skinned)
+    {
+        appendFormat(&json, ",{\"componentType\":5123,\"count\":%" PRIu32 ",\"type\":\"VEC4\"}", encodedVertices);
+        appendFormat(&json, ",{\"componentType\":5126,\"count\":%" PRIu32 ",\"type\":\"VEC4\"}", encodedVertices);
+        appendFormat(&json, ",{\"bufferView\":1,\"componentType\":5126,\"count\":%" PRIu32 ",\"type\":\"MAT4\"}", geometry.jointCount);
+    }
+    appendFormat(&json, "],");
+
+    if (skinned)
+    {
+        appendFormat(&json, "\"skins\":[{\"inverseBindMatrices\":6,\"skeleton\":1,\"joints\":[");
+        for (uint32_t joint = 0; joint < geometry.jointCount; joint++)
+        {
+            appendFormat(&json, "%s%" PRIu32, joint == 0 ? "" : ",", joint + 1);
+        }
+        appendFormat(&json, "]}],");
+    }
+
+    appendFormat(&json, "\"bufferViews\":[{\"buffer\":0,\"byteOffset\":0,\"byteLength\":%zu}", draco.size());
+    if (skinned)
+    {
+        appendFormat(&json, ",{\"buffer\":0,\"byteOffset\":%zu,\"byteLength\":%zu}", matricesOffset, geometry.jointCount * 16 * sizeof(float));
+    }
+    appendFormat(&json, "],\"buffers\":[{\"byteLength\":%zu}]}", bin.size());
+    json.resize((json.size() + 3) & ~size_t(3), ' ');
+
+    std::vector<uint8_t> glb;
+    auto appendWord = [&glb](uint32_t word)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            glb.push_back(static_cast<uint8_t>(word >> (8 * i)));
+        }
+    };
+    appendWord(0x46546C67);
+    appendWord(2);
+    appendWord(static_cast<uint32_t>(12 + 8 + json.size() + 8 + bin.size()));
+    appendWord(static_cast<uint32_t>(json.size()));
+    appendWord(0x4E4F534A);
+    glb.insert(glb.end(), json.begin(), json.end());
+    appendWord(static_cast<uint32_t>(bin.size()));
+    appendWord(0x004E4942);
+    glb.insert(glb.end(), bin.begin(), bin.end());
+    return writeFile(path, glb.data(), glb.size());
+}
+
+uint32_t setAttribute(Encoder *encoder, const char *name, size_t componentType, const char *dataType, const void *data)
+{
+    return encoderSetAttribute(encoder, const_cast<char *>(name), componentType, const_cast<char *>(dataType), const_cast<void *>(data), false);
+}
+
+// Encodes one generated mesh with every method and quantization level and writes the results.
+// Encode times go to their own file so that the manifest only depends on the generated content.
+bool writeEncodings(const std::string &directory, const std::string &baseName, Geometry &geometry, FILE *manifest, FILE *timings)
+{
+    const bool skinned = geometry.jointCount > 0;
+    Encoder *encoder = encoderCreate(geometry.vertexCount);
+    encoderSetIndices(encoder, ComponentType::UnsignedInt, static_cast<uint32_t>(geometry.indices.size()), geometry.indices.data());
+    AttributeIds ids = {};
+    ids.position = setAttribute(encoder, "POSITION", ComponentType::Float, "VEC3", geometry.positions.data());
+    ids.normal = setAttribute(encoder, "NORMAL", ComponentType::Float, "VEC3", geometry.normals.data());
+    ids.uv = setAttribute(encoder, "TEXCOORD_0", ComponentType::Float, "VEC2", geometry.uvs.data());
+    if (skinned)
+    {
+        ids.joints = setAttribute(encoder, "JOINTS_0", ComponentType::UnsignedShort, "VEC4", geometry.joints.data());
+        ids.weights = setAttribute(encoder, "WEIGHTS_0", ComponentType::Float, "VEC4", geometry.weights.data());
+    }
+
+    bool ok = true;
+    std::vector<uint8_t> draco;
+    for (const Quantization &quantization : quantizations)
+    {
+        encoderSetQuantizationBits(encoder, quantization.position, quantization.normal, quantization.uv, quantization.generic, quantization.generic);
+        for (const Method &method : methods)
+        {
+            encoderSetEdgebreakerMethod(encoder, method.edgebreakerMethod);
+            auto start = std::chrono::steady_clock::now();
+            if (!encoderEncode(encoder, method.preserveTriangleOrder))
+            {
+                ok = false;
+                continue;
+            }
+            float encodeMilliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+            draco.resize(encoderGetByteLength(encoder));
+            encoderCopy(encoder, draco.data());
+
+            std::string name = baseName + "_" + method.name + "_q" + std::to_string(quantization.position);
+            std::filesystem::path path = std::filesystem::path(directory) / name;
+            uint32_t encodedVertices = encoderGetEncodedVertexCount(encoder);
+            uint32_t encodedIndices = encoderGetEncodedIndexCount(encoder);
+            if (!writeFile(path.string() + ".drc", draco.data(), draco.size()) ||
+                !writeGlb(path.string() + ".glb", name, geometry, ids, draco, encodedVertices, encodedIndices))
+            {
+                ok = false;
+                continue;
+            }
+            fprintf(manifest, "%s,%zu,%" PRIu32 ",%s,%" PRIu32 ",%zu\n", name.c_str(), geometry.indices.size() / 3, encodedVertices,
+                    method.name, quantization.position, draco.size());
+            fprintf(timings, "%s,%.1f\n", name.c_str(), encodeMilliseconds);
+        }
+    }
+    encoderRelease(encoder);
+    return ok;
+}
+
+std::vector<std::string> splitList(const char *list)
+{
+    std::vector<std::string> items;
+    std::string item;
+    for (const char *c = list;; c++)
+    {
+        if (*c == ',' || *c == '\0')
+        {
+            if (!item.empty())
+            {
+                items.push_back(item);
+            }
+            item.clear();
+            if (*c == '\0')
+            {
+                break;
+            }
+        }
+        else
+        {
+            item += *c;
+        }
+    }
+    return items;
+}
+
+void usage()
+{
+    printf("Usage: corpus_generator [options]\n");
+    printf("\n");
+    printf("Generates Draco compressed .drc and .glb files of synthetic meshes.\n");
+    printf("\n");
+    printf("Options:\n");
+    printf("  -h | -?            show help.\n");
+    printf("  -o <directory>     output directory, default=corpus.\n");
+    printf("  -sizes <list>      comma separated triangle counts,\n");
+    printf("                     default=1000,10000,100000,1000000,20000000.\n");
+    printf("  -families <list>   comma separated families out of grid, sphere, terrain,\n");
+    printf("                     seams, skinned and cad, default=all.\n");
+    printf("  -seed <value>      seed of the random content, default=1.\n");
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::string directory = "corpus";
+    std::vector<std::string> sizes = splitList("1000,10000,100000,1000000,20000000");
+    std::vector<std::string> familyNames;
+    uint32_t seed = 1;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-h") || !strcmp(argv[i], "-?"))
+        {
+            usage();
+            return 0;
+        }
+        else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+        {
+            directory = argv[++i];
+        }
+        else if (!strcmp(argv[i], "-sizes") && i + 1 < argc)
+        {
+            sizes = splitList(argv[++i]);
+        }
+        else if (!strcmp(argv[i], "-families") && i + 1 < argc)
+        {
+            familyNames = splitList(argv[++i]);
+        }
+        else if (!strcmp(argv[i], "-seed") && i + 1 < argc)
+        {
+            seed = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+    for (const std::string &familyName : familyNames)
+    {
+        if (std::none_of(std::begin(families), std::end(families), [&](const Family &family) { return familyName == family.name; }))
+        {
+            printf(LOG_PREFIX "Unknown family %s\n", familyName.c_str());
+            return 1;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    FILE *manifest = fopen((std::filesystem::path(directory) / "corpus.csv").string().c_str(), "w");
+    FILE *timings = fopen((std::filesystem::path(directory) / "encode_times.csv").string().c_str(), "w");
+    if (!manifest || !timings)
+    {
+        printf(LOG_PREFIX "Cannot write to %s\n", directory.c_str());
+        if (manifest)
+        {
+            fclose(manifest);
+        }
+        if (timings)
+        {
+            fclose(timings);
+        }
+        return 1;
+    }
+    fprintf(manifest, "name,triangles,vertices,method,position_bits,bytes\n");
+    fprintf(timings, "name,encode_ms\n");
+
+    bool ok = true;
+    for (const Family &family : families)
+    {
+        if (!familyNames.empty() && std::find(familyNames.begin(), familyNames.end(), family.name) == familyNames.end())
+        {
+            continue;
+        }
+        for (const std::string &size : sizes)
+        {
+            uint32_t targetTriangles = static_cast<uint32_t>(strtoul(size.c_str(), nullptr, 10));
+            if (targetTriangles == 0)
+            {
+                printf(LOG_PREFIX "Invalid size %s\n", size.c_str());
+                ok = false;
+                continue;
+            }
+            //Every mesh has its own seed so that any subset of the corpus is generated identically
+            uint32_t meshSeed = seed * 0x9E3779B1u ^ targetTriangles ^ static_cast<uint32_t>(std::hash<std::string>()(family.name));
+            std::string baseName = std::string(family.name) + "_" + sizeLabel(targetTriangles);
+            printf(LOG_PREFIX "Generating %s\n", baseName.c_str());
+            Geometry geometry;
+            if (!family.generate(targetTriangles, meshSeed, &geometry) || !writeEncodings(directory, baseName, geometry, manifest, timings))
+            {
+                printf(LOG_PREFIX "Failed to generate %s\n", baseName.c_str());
+                ok = false;
+            }
+        }
+    }
+    fclose(manifest);
+    fclose(timings);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,416 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 itslebi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "DracoAnimation.hpp"
+#include "ParallelFor.hpp"
+
+#include <src/animation.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+using namespace godot;
+
+//Number of values per key of the tracks that can be Draco compressed, 0 for every other track type
+static int get_track_components(Animation::TrackType p_type) {
+    switch (p_type) {
+        case Animation::TYPE_POSITION_3D:
+        case Animation::TYPE_SCALE_3D:
+            return 3;
+        case Animation::TYPE_ROTATION_3D:
+            return 4;
+        case Animation::TYPE_BLEND_SHAPE:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+//The keys of these tracks are exposed as one packed array of [time, transition, values...] per key
+static String get_keys_property(int p_track) {
+    return "tracks/" + String::num_int64(p_track) + "/keys";
+}
+
+void DracoAnimation::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("set_base", "base"), &DracoAnimation::set_base);
+    ClassDB::bind_method(D_METHOD("get_base"), &DracoAnimation::get_base);
+    ClassDB::bind_method(D_METHOD("set_buffers", "buffers"), &DracoAnimation::set_buffers);
+    ClassDB::bind_method(D_METHOD("get_buffers"), &DracoAnimation::get_buffers);
+    ClassDB::bind_method(D_METHOD("set_tracks", "tracks"), &DracoAnimation::set_tracks);
+    ClassDB::bind_method(D_METHOD("get_tracks"), &DracoAnimation::get_tracks);
+    ClassDB::bind_method(D_METHOD("get_animation"), &DracoAnimation::get_animation);
+    ClassDB::bind_method(D_METHOD("is_decoded"), &DracoAnimation::is_decoded);
+    ClassDB::bind_method(D_METHOD("clear_decoded"), &DracoAnimation::clear_decoded);
+    ClassDB::bind_static_method("DracoAnimation", D_METHOD("compress", "animation", "compression_level", "position_bits", "rotation_bits", "scale_bits", "blend_shape_bits"), &DracoAnimation::compress, DEFVAL(7), DEFVAL(16), DEFVAL(16), DEFVAL(16), DEFVAL(16));
+
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "base", PROPERTY_HINT_RESOURCE_TYPE, "Animation", PROPERTY_USAGE_STORAGE), "set_base", "get_base");
+    ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "buffers", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_STORAGE), "set_buffers", "get_buffers");
+    ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "tracks", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_STORAGE), "set_tracks", "get_tracks");
+}
+
+//Default Constructor and destructor
+DracoAnimation::DracoAnimation() {}
+DracoAnimation::~DracoAnimation() {}
+
+void DracoAnimation::set_base(const Ref<Animation> &p_base) {
+    std::lock_guard<std::mutex> lock(decode_mutex);
+    base = p_base;
+    animation.unref();
+}
+
+Ref<Animation> DracoAnimation::get_base() const {
+    return base;
+}
+
+void DracoAnimation::set_buffers(const Array &p_buffers) {
+    std::lock_guard<std::mutex> lock(decode_mutex);
+    buffers = p_buffers;
+    animation.unref();
+}
+
+Array DracoAnimation::get_buffers() const {
+    return buffers;
+}
+
+void DracoAnimation::set_tracks(const Array &p_tracks) {
+    std::lock_guard<std::mutex> lock(decode_mutex);
+    tracks = p_tracks;
+    animation.unref();
+}
+
+Array DracoAnimation::get_tracks() const {
+    return tracks;
+}
+
+Ref<Animation> DracoAnimation::get_animation() {
+    std::lock_guard<std::mutex> lock(decode_mutex);
+    if (animation.is_valid() || base.is_null()) {
+        return animation;
+    }
+
+    //Everything the workers need is copied out first, they only touch their own tracks
+    struct DecodedTrack {
+        int buffer;
+        int32_t id;
+        Animation::TrackType type;
+        PackedFloat32Array transitions;
+        PackedFloat32Array keys;
+    };
+    std::vector<DecodedTrack> decoded_tracks(tracks.size());
+    std::vector<std::vector<int>> buffer_tracks(buffers.size());
+    std::vector<PackedByteArray> buffer_data(buffers.size());
+    for (int i = 0; i < buffers.size(); i++) {
+        buffer_data[i] = buffers[i];
+    }
+    for (int i = 0; i < tracks.size(); i++) {
+        Dictionary track = tracks[i];
+        DecodedTrack &decoded_track = decoded_tracks[i];
+        decoded_track.buffer = track["buffer"];
+        decoded_track.id = track["id"];
+        decoded_track.type = static_cast<Animation::TrackType>(static_cast<int>(track["type"]));
+        decoded_track.transitions = track.get("transitions", PackedFloat32Array());
+        ERR_FAIL_INDEX_V(decoded_track.buffer, buffers.size(), nullptr);
+        buffer_tracks[decoded_track.buffer].push_back(i);
+    }
+
+    //Every Draco animation is decoded on its own worker thread
+    std::atomic<bool> failed(false);
+    parallel_for(buffer_data.size(), [&](uint32_t p_buffer) {
+        const PackedByteArray &data = buffer_data[p_buffer];
+        AnimationDecoder *decoder = animationDecoderCreate();
+        if (!animationDecoderDecode(decoder, (void *)data.ptr(), data.size())) {
+            animationDecoderRelease(decoder);
+            failed = true;
+            return;
+        }
+
+        const uint32_t frame_count = animationDecoderGetFrameCount(decoder);
+        std::vector<float> times(frame_count);
+        std::vector<float> values;
+        animationDecoderCopyTimestamps(decoder, times.data());
+
+        for (int track_index : buffer_tracks[p_buffer]) {
+            DecodedTrack &track = decoded_tracks[track_index];
+            const int components = get_track_components(track.type);
+            if (components == 0 || animationDecoderGetTrackComponentCount(decoder, track.id) != static_cast<uint32_t>(components)) {
+                failed = true;
+                break;
+            }
+            values.resize(frame_count * components);
+            if (!animationDecoderCopyTrack(decoder, track.id, values.data())) {
+                failed = true;
+                break;
+            }
+
+            //Tracks without stored transitions only used the default of 1
+            const float *transitions = nullptr;
+            if (!track.transitions.is_empty()) {
+                if (track.transitions.size() != static_cast<int64_t>(frame_count)) {
+                    failed = true;
+                    break;
+                }
+                transitions = track.transitions.ptr();
+            }
+
+            const int stride = components + 2;
+            track.keys.resize(frame_count * stride);
+            float *keys = track.keys.ptrw();
+            for (uint32_t frame = 0; frame < frame_count; frame++) {
+                float *key = keys + frame * stride;
+                const float *value = values.data() + frame * components;
+                key[0] = times[frame];
+                key[1] = transitions ? transitions[frame] : 1.0f;
+                for (int c = 0; c < components; c++) {
+                    key[2 + c] = value[c];
+                }
+                //Quantized rotations are no longer exactly unit length
+                if (track.type == Animation::TYPE_ROTATION_3D) {
+                    const float length_squared = value[0] * value[0] + value[1] * value[1] + value[2] * value[2] + value[3] * value[3];
+                    if (length_squared > 0.0f && std::fabs(length_squared - 1.0f) > 1e-6f) {
+                        const float inv_length = 1.0f / std::sqrt(length_squared);
+                        for (int c = 0; c < 4; c++) {
+                            key[2 + c] *= inv_length;
+                        }
+                    }
+                }
+            }
+        }
+        animationDecoderRelease(decoder);
+    }, "DracoAnimation: decoding tracks");
+
+    if (failed) {
+        ERR_FAIL_V_MSG(nullptr, "Failed to decode DracoAnimation tracks.");
+    }
+
+    //The base animation holds the other tracks in their source order, inserting the compressed tracks by increasing
+    //source index puts every track back where it was
+    Ref<Animation> decoded_animation = base->duplicate();
+    for (int i = 0; i < tracks.size(); i++) {
+        Dictionary track = tracks[i];
+        const int index = decoded_animation->add_track(decoded_tracks[i].type, track.get("index", -1));
+        decoded_animation->track_set_path(index, track["path"]);
+        decoded_animation->track_set_interpolation_type(index, static_cast<Animation::InterpolationType>(static_cast<int>(track["interpolation"])));
+        decoded_animation->track_set_interpolation_loop_wrap(index, track["loop_wrap"]);
+        decoded_animation->track_set_enabled(index, track["enabled"]);
+        decoded_animation->track_set_imported(index, track["imported"]);
+        //Fills the whole track at once instead of inserting the keys one by one
+        decoded_animation->set(get_keys_property(index), decoded_tracks[i].keys);
+    }
+
+    animation = decoded_animation;
+    return animation;
+}
+
+bool DracoAnimation::is_decoded() {
+    std::lock_guard<std::mutex> lock(decode_mutex);
+    return animation.is_valid();
+}
+
+void DracoAnimation::clear_decoded() {
+    std::lock_guard<std::mutex> lock(decode_mutex);
+    animation.unref();
+}
+
+Ref<DracoAnimation> DracoAnimation::compress(const Ref<Animation> &p_animation, int p_compression_level, int p_position_bits, int p_rotation_bits, int p_scale_bits, int p_blend_shape_bits) {
+    ERR_FAIL_COND_V_MSG(p_animation.is_null(), nullptr, "Can't compress a null animation.");
+
+    Ref<Animation> base_animation;
+    base_animation.instantiate();
+    base_animation->set_length(p_animation->get_length());
+    base_animation->set_loop_mode(p_animation->get_loop_mode());
+    base_animation->set_step(p_animation->get_step());
+
+    struct TrackValues {
+        int track;
+        Animation::TrackType type;
+        PackedFloat32Array values;
+        //Empty when every key uses the default transition of 1
+        PackedFloat32Array transitions;
+    };
+    //Tracks with the same key times share the timestamps of a Draco animation
+    struct TrackGroup {
+        PackedFloat32Array times;
+        std::vector<TrackValues> tracks;
+    };
+    std::vector<TrackGroup> groups;
+
+    for (int i = 0; i < p_animation->get_track_count(); i++) {
+        const Animation::TrackType type = p_animation->track_get_type(i);
+        const int components = get_track_components(type);
+        if (components == 0) {
+            p_animation->copy_track(i, base_animation);
+            continue;
+        }
+        if (p_animation->track_is_compressed(i)) {
+            ERR_FAIL_V_MSG(nullptr, "Track " + String::num_int64(i) + " uses Godot's animation compression and can't be read.");
+        }
+
+        const PackedFloat32Array keys = p_animation->get(get_keys_property(i));
+        const int stride = components + 2;
+        const int key_count = keys.size() / stride;
+        if (key_count == 0) {
+            p_animation->copy_track(i, base_animation);
+            continue;
+        }
+
+        PackedFloat32Array times;
+        times.resize(key_count);
+        TrackValues track_values;
+        track_values.track = i;
+        track_values.type = type;
+        track_values.values.resize(key_count * components);
+        const float *key = keys.ptr();
+        float *time = times.ptrw();
+        float *value = track_values.values.ptrw();
+        for (int k = 0; k < key_count; k++) {
+            time[k] = key[k * stride];
+            for (int c = 0; c < components; c++) {
+                value[k * components + c] = key[k * stride + 2 + c];
+            }
+        }
+        for (int k = 0; k < key_count; k++) {
+            if (key[k * stride + 1] != 1.0f) {
+                track_values.transitions.resize(key_count);
+                float *transition = track_values.transitions.ptrw();
+                for (int t = 0; t < key_count; t++) {
+                    transition[t] = key[t * stride + 1];
+                }
+                break;
+            }
+        }
+
+        TrackGroup *group = nullptr;
+        for (TrackGroup &existing_group : groups) {
+            if (existing_group.times == times) {
+                group = &existing_group;
+                break;
+            }
+        }
+        if (group == nullptr) {
+            groups.push_back(TrackGroup());
+            group = &groups.back();
+            group->times = times;
+        }
+        group->tracks.push_back(track_values);
+    }
+
+    //Large groups are split so that the buffers can be decoded in parallel
+    struct BufferJob {
+        const TrackGroup *group;
+        size_t first_track;
+        size_t track_count;
+        std::vector<int32_t> ids;
+        PackedByteArray data;
+    };
+    std::vector<BufferJob> jobs;
+    for (const TrackGroup &group : groups) {
+        for (size_t first = 0; first < group.tracks.size(); first += TRACKS_PER_BUFFER) {
+            BufferJob job;
+            job.group = &group;
+            job.first_track = first;
+            job.track_count = std::min(group.tracks.size() - first, static_cast<size_t>(TRACKS_PER_BUFFER));
+            jobs.push_back(job);
+        }
+    }
+
+    parallel_for(jobs.size(), [&](uint32_t p_job) {
+        BufferJob &job = jobs[p_job];
+        AnimationEncoder *encoder = animationEncoderCreate(job.group->times.size(), job.group->times.ptr());
+        if (!encoder) {
+            return;
+        }
+        animationEncoderSetCompressionLevel(encoder, p_compression_level);
+
+        for (size_t i = job.first_track; i < job.first_track + job.track_count; i++) {
+            const TrackValues &track_values = job.group->tracks[i];
+            int bits = p_blend_shape_bits;
+            if (track_values.type == Animation::TYPE_POSITION_3D) {
+                bits = p_position_bits;
+            } else if (track_values.type == Animation::TYPE_ROTATION_3D) {
+                bits = p_rotation_bits;
+            } else if (track_values.type == Animation::TYPE_SCALE_3D) {
+                bits = p_scale_bits;
+            }
+            const int32_t id = animationEncoderAddTrack(encoder, get_track_components(track_values.type), track_values.values.ptr(), bits);
+            if (id < 0) {
+                animationEncoderRelease(encoder);
+                return;
+            }
+            job.ids.push_back(id);
+        }
+
+        if (animationEncoderEncode(encoder)) {
+            job.data.resize(animationEncoderGetByteLength(encoder));
+            animationEncoderCopy(encoder, job.data.ptrw());
+        }
+        animationEncoderRelease(encoder);
+    }, "DracoAnimation: compressing tracks");
+
+    Ref<DracoAnimation> draco_animation;
+    draco_animation.instantiate();
+    draco_animation->set_name(p_animation->get_name());
+
+    //Compressed tracks are listed by increasing source index, which get_animation() relies on
+    std::vector<Dictionary> track_infos(p_animation->get_track_count());
+    Array compressed_buffers;
+    for (const BufferJob &job : jobs) {
+        if (job.data.is_empty()) {
+            ERR_FAIL_V_MSG(nullptr, "Failed to compress animation tracks.");
+        }
+        for (size_t i = 0; i < job.track_count; i++) {
+            const TrackValues &track_values = job.group->tracks[job.first_track + i];
+            const int track = track_values.track;
+            Dictionary info;
+            info["index"] = track;
+            info["path"] = p_animation->track_get_path(track);
+            info["type"] = static_cast<int64_t>(p_animation->track_get_type(track));
+            info["interpolation"] = static_cast<int64_t>(p_animation->track_get_interpolation_type(track));
+            info["loop_wrap"] = p_animation->track_get_interpolation_loop_wrap(track);
+            info["enabled"] = p_animation->track_is_enabled(track);
+            info["imported"] = p_animation->track_is_imported(track);
+            info["buffer"] = compressed_buffers.size();
+            info["id"] = job.ids[i];
+            //Transitions are kept exactly, they are rarely anything but the default
+            if (!track_values.transitions.is_empty()) {
+                info["transitions"] = track_values.transitions;
+            }
+            track_infos[track] = info;
+        }
+        compressed_buffers.append(job.data);
+    }
+
+    Array compressed_tracks;
+    for (const Dictionary &info : track_infos) {
+        if (!info.is_empty()) {
+            compressed_tracks.append(info);
+        }
+    }
+
+    draco_animation->set_base(base_animation);
+    draco_animation->set_buffers(compressed_buffers);
+    draco_animation->set_tracks(compressed_tracks);
+    return draco_animation;
+}
@@ -0,0 +1,81 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 itslebi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef DRACO_ANIMATION_HPP
+#define DRACO_ANIMATION_HPP
+
+#include <godot_cpp/classes/resource.hpp>
+#include <godot_cpp/classes/animation.hpp>
+
+#include <mutex>
+
+namespace godot {
+    //Resource that keeps the position, rotation, scale and blend shape tracks of an Animation as Draco keyframe
+    //animations and only decodes them on first access
+    class DracoAnimation: public Resource {
+        GDCLASS(DracoAnimation, Resource);
+
+        private:
+            //Length, loop mode, step and every track that can't be Draco compressed
+            Ref<Animation> base;
+            //Draco keyframe animations, each holding up to TRACKS_PER_BUFFER tracks sharing the same key times
+            Array buffers;
+            //One Dictionary per compressed track with its settings and where its keys are stored
+            Array tracks;
+            Ref<Animation> animation;
+            std::mutex decode_mutex;
+
+        protected:
+            static void _bind_methods();
+
+        public:
+            //Small enough to decode the buffers of a long animation on several threads
+            static const int TRACKS_PER_BUFFER = 8;
+
+            DracoAnimation();
+            ~DracoAnimation();
+
+            void set_base(const Ref<Animation> &p_base);
+            Ref<Animation> get_base() const;
+
+            void set_buffers(const Array &p_buffers);
+            Array get_buffers() const;
+
+            void set_tracks(const Array &p_tracks);
+            Array get_tracks() const;
+
+            //Decodes the tracks the first time it is called and returns the cached animation afterwards (thread safe)
+            Ref<Animation> get_animation();
+            bool is_decoded();
+
+            //Drops the decoded animation so only the compressed bytes stay resident
+            void clear_decoded();
+
+            //Compresses the transform and blend shape tracks of an Animation, quantizing their values to the given
+            //number of bits (0 keeps them lossless). Key times are always lossless and key transitions are not kept.
+            static Ref<DracoAnimation> compress(const Ref<Animation> &p_animation, int p_compression_level, int p_position_bits, int p_rotation_bits, int p_scale_bits, int p_blend_shape_bits);
+    };
+}
+
+#endif //DRACO_ANIMATION_HPP
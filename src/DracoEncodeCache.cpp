@@ -0,0 +1,115 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 itslebi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "DracoEncodeCache.hpp"
+
+#include <godot_cpp/classes/dir_access.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/hashing_context.hpp>
+#include <godot_cpp/classes/mesh.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/project_settings.hpp>
+#include <godot_cpp/variant/packed_color_array.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
+#include <godot_cpp/variant/packed_vector2_array.hpp>
+#include <godot_cpp/variant/packed_vector3_array.hpp>
+
+#include "draco/core/draco_version.h"
+
+using namespace godot;
+
+//Bump when the encoded output changes for the same input and settings, so stale entries are never reused
+static const char *CACHE_FORMAT = "gddraco-encode-cache-2";
+
+static String get_cache_dir() {
+    return ProjectSettings::get_singleton()->get_setting("gddraco/encoder/cache_dir", "");
+}
+
+static void hash_bytes(const Ref<HashingContext> &p_context, const PackedByteArray &p_bytes) {
+    //The length goes in first so missing and empty arrays can't be confused with the next one
+    PackedByteArray length;
+    length.resize(8);
+    length.encode_u64(0, p_bytes.size());
+    p_context->update(length);
+    if (!p_bytes.is_empty()) {
+        p_context->update(p_bytes);
+    }
+}
+
+bool DracoEncodeCache::is_enabled() {
+    return !get_cache_dir().is_empty();
+}
+
+String DracoEncodeCache::get_key(const Array &p_arrays, const PackedInt32Array &p_settings) {
+    Ref<HashingContext> context;
+    context.instantiate();
+    context->start(HashingContext::HASH_SHA256);
+
+    hash_bytes(context, (String(CACHE_FORMAT) + "/" + draco::Version()).to_utf8_buffer());
+    hash_bytes(context, p_settings.to_byte_array());
+
+    //Only the arrays read by the encoder are part of the key
+    hash_bytes(context, PackedVector3Array(p_arrays[Mesh::ARRAY_VERTEX]).to_byte_array());
+    hash_bytes(context, PackedVector3Array(p_arrays[Mesh::ARRAY_NORMAL]).to_byte_array());
+    hash_bytes(context, PackedFloat32Array(p_arrays[Mesh::ARRAY_TANGENT]).to_byte_array());
+    hash_bytes(context, PackedColorArray(p_arrays[Mesh::ARRAY_COLOR]).to_byte_array());
+    hash_bytes(context, PackedVector2Array(p_arrays[Mesh::ARRAY_TEX_UV]).to_byte_array());
+    hash_bytes(context, PackedVector2Array(p_arrays[Mesh::ARRAY_TEX_UV2]).to_byte_array());
+    hash_bytes(context, PackedInt32Array(p_arrays[Mesh::ARRAY_BONES]).to_byte_array());
+    hash_bytes(context, PackedFloat32Array(p_arrays[Mesh::ARRAY_WEIGHTS]).to_byte_array());
+    hash_bytes(context, PackedInt32Array(p_arrays[Mesh::ARRAY_INDEX]).to_byte_array());
+
+    return context->finish().hex_encode();
+}
+
+PackedByteArray DracoEncodeCache::load(const String &p_key) {
+    String path = get_path(p_key);
+    if (!FileAccess::file_exists(path)) {
+        return PackedByteArray();
+    }
+    return FileAccess::get_file_as_bytes(path);
+}
+
+void DracoEncodeCache::store(const String &p_key, const PackedByteArray &p_data) {
+    String path = get_path(p_key);
+    Error err = DirAccess::make_dir_recursive_absolute(path.get_base_dir());
+    ERR_FAIL_COND_MSG(err != OK, "Can't create Draco cache directory " + path.get_base_dir() + ".");
+
+    //Written to a temporary file first so concurrent exports (and threads) never read a partial entry
+    OS *os = OS::get_singleton();
+    String temp_path = path + "." + String::num_int64(os->get_process_id()) + "_" + String::num_uint64(os->get_thread_caller_id()) + ".tmp";
+    Ref<FileAccess> file = FileAccess::open(temp_path, FileAccess::WRITE);
+    ERR_FAIL_COND_MSG(file.is_null(), "Can't write Draco cache entry " + temp_path + ".");
+    file->store_buffer(p_data);
+    file->close();
+
+    if (DirAccess::rename_absolute(temp_path, path) != OK) {
+        DirAccess::remove_absolute(temp_path);
+    }
+}
+
+//Entries are spread over 256 sub directories to keep directory listings short for big projects
+String DracoEncodeCache::get_path(const String &p_key) {
+    return get_cache_dir().path_join(p_key.substr(0, 2)).path_join(p_key + ".drc");
+}
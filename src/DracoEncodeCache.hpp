@@ -0,0 +1,53 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 itslebi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef DRACO_ENCODE_CACHE_HPP
+#define DRACO_ENCODE_CACHE_HPP
+
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+namespace godot {
+    //Content addressed on-disk store of encoded surfaces, so re-exporting unchanged meshes skips the encoder.
+    //Entries are keyed by a SHA-256 of the surface arrays and encoder settings and live in the directory
+    //set in gddraco/encoder/cache_dir (an empty path disables the cache).
+    class DracoEncodeCache {
+    public:
+        static bool is_enabled();
+
+        //p_settings holds every encoder option that affects the output
+        static String get_key(const Array &p_arrays, const PackedInt32Array &p_settings);
+
+        //Returns an empty buffer when there is no entry for the key
+        static PackedByteArray load(const String &p_key);
+        static void store(const String &p_key, const PackedByteArray &p_data);
+
+    private:
+        static String get_path(const String &p_key);
+    };
+}
+
+#endif //DRACO_ENCODE_CACHE_HPP
@@ -0,0 +1,99 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 itslebi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "DracoExportPlugin.hpp"
+#include "DracoMesh.hpp"
+
+#include <godot_cpp/classes/project_settings.hpp>
+#include <godot_cpp/classes/resource_loader.hpp>
+
+using namespace godot;
+
+void DracoExportPlugin::_bind_methods() {}
+
+//Default Constructor and destructor
+DracoExportPlugin::DracoExportPlugin() {}
+DracoExportPlugin::~DracoExportPlugin() {}
+
+String DracoExportPlugin::_get_name() const {
+    return "GDDraco";
+}
+
+void DracoExportPlugin::_export_file(const String &p_path, const String &p_type, const PackedStringArray &p_features) {
+    ProjectSettings *settings = ProjectSettings::get_singleton();
+    if (!bool(settings->get_setting("gddraco/export/compress_meshes", false)) || p_type != "ArrayMesh") {
+        return;
+    }
+
+    //Draco files are already compressed
+    const String extension = p_path.get_extension().to_lower();
+    if (extension == "drc" || extension == "dracomesh") {
+        return;
+    }
+
+    //A .dracomesh would load as a DracoMesh, which is no Mesh, so scenes using the mesh would break
+    if (bool(settings->get_setting("gddraco/drc/lazy_decode", false))) {
+        return;
+    }
+
+    Ref<ArrayMesh> mesh = ResourceLoader::get_singleton()->load(p_path, "ArrayMesh");
+    if (mesh.is_null()) {
+        return;
+    }
+
+    //Meshes that can't be compressed (blend shapes, custom arrays, lines...) are exported unchanged,
+    //the unchanged surfaces of the others come from the encode cache when gddraco/encoder/cache_dir is set
+    Ref<DracoMesh> draco_mesh = DracoMesh::compress(mesh,
+            settings->get_setting("gddraco/encoder/compression_level", 7),
+            settings->get_setting("gddraco/encoder/position_bits", 14),
+            settings->get_setting("gddraco/encoder/normal_bits", 10),
+            settings->get_setting("gddraco/encoder/uv_bits", 12));
+    if (draco_mesh.is_null()) {
+        WARN_PRINT("Exporting " + p_path + " uncompressed, it can't be Draco compressed.");
+        return;
+    }
+    if (draco_mesh->has_embedded_materials()) {
+        WARN_PRINT("Exporting " + p_path + " uncompressed, a .dracomesh file can't keep its embedded materials.");
+        return;
+    }
+
+    //The remap makes loads of the original path open the .dracomesh file, which DracoLoader decodes to an ArrayMesh
+    add_file(p_path + ".dracomesh", draco_mesh->get_file_buffer(), true);
+}
+
+void DracoEditorPlugin::_bind_methods() {}
+
+//Default Constructor and destructor
+DracoEditorPlugin::DracoEditorPlugin() {}
+DracoEditorPlugin::~DracoEditorPlugin() {}
+
+void DracoEditorPlugin::_enter_tree() {
+    export_plugin.instantiate();
+    add_export_plugin(export_plugin);
+}
+
+void DracoEditorPlugin::_exit_tree() {
+    remove_export_plugin(export_plugin);
+    export_plugin.unref();
+}
@@ -0,0 +1,67 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 itslebi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef DRACO_EXPORT_PLUGIN_HPP
+#define DRACO_EXPORT_PLUGIN_HPP
+
+#include <godot_cpp/classes/editor_export_plugin.hpp>
+#include <godot_cpp/classes/editor_plugin.hpp>
+
+namespace godot {
+    //Replaces standalone ArrayMesh resources with .dracomesh files in exported builds when
+    //gddraco/export/compress_meshes is enabled. Meshes built into scenes are exported unchanged
+    class DracoExportPlugin: public EditorExportPlugin {
+        GDCLASS(DracoExportPlugin, EditorExportPlugin);
+
+        protected:
+            static void _bind_methods();
+
+        public:
+            DracoExportPlugin();
+            ~DracoExportPlugin();
+
+            String _get_name() const override;
+            void _export_file(const String &p_path, const String &p_type, const PackedStringArray &p_features) override;
+    };
+
+    //Editor plugin that only exists to add DracoExportPlugin to the export dialog
+    class DracoEditorPlugin: public EditorPlugin {
+        GDCLASS(DracoEditorPlugin, EditorPlugin);
+
+        private:
+            Ref<DracoExportPlugin> export_plugin;
+
+        protected:
+            static void _bind_methods();
+
+        public:
+            DracoEditorPlugin();
+            ~DracoEditorPlugin();
+
+            void _enter_tree() override;
+            void _exit_tree() override;
+    };
+}
+
+#endif //DRACO_EXPORT_PLUGIN_HPP
@@ -0,0 +1,116 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 itslebi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "DracoLoader.hpp"
+#include "DracoMesh.hpp"
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/project_settings.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+using namespace godot;
+
+void DracoLoader::_bind_methods() {}
+
+//Default Constructor and destructor
+DracoLoader::DracoLoader() {}
+DracoLoader::~DracoLoader() {}
+
+//Returns if .drc and .dracomesh files should load as a DracoMesh that decodes on first access
+static bool use_lazy_decode() {
+    return ProjectSettings::get_singleton()->get_setting("gddraco/drc/lazy_decode", false);
+}
+
+PackedStringArray DracoLoader::_get_recognized_extensions() const {
+    PackedStringArray extensions;
+    extensions.append("drc");
+    extensions.append("dracomesh");
+    return extensions;
+}
+
+//A DracoMesh is no Mesh, so loads that expect one mustn't come here while decoding lazily
+bool DracoLoader::_handles_type(const StringName &p_type) const {
+    if (use_lazy_decode()) {
+        return p_type == StringName("DracoMesh");
+    }
+    return p_type == StringName("ArrayMesh") || p_type == StringName("Mesh") || p_type == StringName("DracoMesh");
+}
+
+String DracoLoader::_get_resource_type(const String &p_path) const {
+    const String extension = p_path.get_extension().to_lower();
+    if (extension != "drc" && extension != "dracomesh") {
+        return String();
+    }
+    return use_lazy_decode() ? "DracoMesh" : "ArrayMesh";
+}
+
+PackedStringArray DracoLoader::_get_dependencies(const String &p_path, bool p_add_types) const {
+    PackedStringArray dependencies;
+    if (p_path.get_extension().to_lower() != "dracomesh") {
+        return dependencies;
+    }
+    const PackedStringArray material_paths = DracoMesh::get_file_dependencies(p_path);
+    for (int i = 0; i < material_paths.size(); i++) {
+        dependencies.append(p_add_types ? material_paths[i] + "::Material" : material_paths[i]);
+    }
+    return dependencies;
+}
+
+Variant DracoLoader::_load(const String &p_path, const String &p_original_path, bool p_use_sub_threads, int32_t p_cache_mode) const {
+    //Multi-surface meshes written by DracoSaver
+    if (p_path.get_extension().to_lower() == "dracomesh") {
+        Ref<DracoMesh> draco_mesh = DracoMesh::load_file(p_path);
+        if (draco_mesh.is_null()) {
+            return ERR_FILE_CORRUPT;
+        }
+        if (use_lazy_decode()) {
+            return draco_mesh;
+        }
+        Ref<ArrayMesh> mesh = draco_mesh->get_mesh();
+        if (mesh.is_null()) {
+            return ERR_FILE_CORRUPT;
+        }
+        return mesh;
+    }
+
+    PackedByteArray buffer = FileAccess::get_file_as_bytes(p_path);
+    if (buffer.is_empty()) {
+        UtilityFunctions::printerr("Failed to read Draco file: " + p_path);
+        return ERR_FILE_CANT_READ;
+    }
+
+    //Only keep the compressed bytes resident, decoding happens on the first get_mesh()
+    if (use_lazy_decode()) {
+        Ref<DracoMesh> draco_mesh;
+        draco_mesh.instantiate();
+        draco_mesh->add_surface(buffer, Ref<Material>());
+        return draco_mesh;
+    }
+
+    Ref<ArrayMesh> mesh = DracoMesh::decode_buffer(buffer);
+    if (mesh.is_null()) {
+        return ERR_FILE_CORRUPT;
+    }
+    return mesh;
+}
@@ -0,0 +1,550 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 itslebi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "DracoMesh.hpp"
+#include "DracoEncodeCache.hpp"
+#include "GDDraco.hpp"
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/project_settings.hpp>
+#include <godot_cpp/classes/resource_loader.hpp>
+#include <godot_cpp/classes/stream_peer_buffer.hpp>
+
+#include <src/decoder.h>
+#include <src/encoder.h>
+
+#include <vector>
+
+using namespace godot;
+
+//A .dracomesh file starts with the magic, the format version and the surface count. Every surface follows as its
+//byte count, its Draco buffer and the path of its material (empty when it has none)
+static const char *DRACOMESH_MAGIC = "GDDM";
+static const uint32_t DRACOMESH_VERSION = 1;
+
+//Checks the header of a .dracomesh file and returns its surface count, or -1 if it isn't one
+static int64_t read_dracomesh_header(const Ref<FileAccess> &p_file) {
+    if (p_file->get_buffer(4) != String(DRACOMESH_MAGIC).to_ascii_buffer()) {
+        return -1;
+    }
+    if (p_file->get_32() != DRACOMESH_VERSION) {
+        return -1;
+    }
+    return p_file->get_32();
+}
+
+//Returns if the surface array at p_index holds any data
+static bool has_surface_array(const Array &p_arrays, int p_index) {
+    const Variant array = p_arrays[p_index];
+    return array.get_type() != Variant::NIL && array.booleanize();
+}
+
+//Reads a float attribute into a packed array of p_element_count elements, returns false if the sizes don't match
+template <typename T>
+static bool copy_float_attribute(Decoder *p_decoder, int p_id, const char *p_data_type, uint32_t p_element_count, T &r_array) {
+    if (!decoderReadAttribute(p_decoder, p_id, 5126, (char *)p_data_type)) {
+        return false;
+    }
+    r_array.resize(p_element_count);
+    if (decoderGetAttributeByteLength(p_decoder, p_id) != p_element_count * sizeof(*r_array.ptr())) {
+        return false;
+    }
+    decoderCopyAttribute(p_decoder, p_id, r_array.ptrw());
+    return true;
+}
+
+void DracoMesh::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("set_surfaces", "surfaces"), &DracoMesh::set_surfaces);
+    ClassDB::bind_method(D_METHOD("get_surfaces"), &DracoMesh::get_surfaces);
+    ClassDB::bind_method(D_METHOD("set_materials", "materials"), &DracoMesh::set_materials);
+    ClassDB::bind_method(D_METHOD("get_materials"), &DracoMesh::get_materials);
+    ClassDB::bind_method(D_METHOD("add_surface", "data", "material"), &DracoMesh::add_surface, DEFVAL(Ref<Material>()));
+    ClassDB::bind_method(D_METHOD("get_surface_count"), &DracoMesh::get_surface_count);
+    ClassDB::bind_method(D_METHOD("get_surface_data", "surface"), &DracoMesh::get_surface_data);
+    ClassDB::bind_method(D_METHOD("get_mesh"), &DracoMesh::get_mesh);
+    ClassDB::bind_method(D_METHOD("is_decoded"), &DracoMesh::is_decoded);
+    ClassDB::bind_method(D_METHOD("clear_decoded"), &DracoMesh::clear_decoded);
+    ClassDB::bind_static_method("DracoMesh", D_METHOD("compress", "mesh", "compression_level", "position_bits", "normal_bits", "uv_bits"), &DracoMesh::compress, DEFVAL(7), DEFVAL(14), DEFVAL(10), DEFVAL(12));
+    ClassDB::bind_static_method("DracoMesh", D_METHOD("compress_tuned", "mesh", "max_position_error", "max_uv_error", "max_decode_msec"), &DracoMesh::compress_tuned, DEFVAL(0.0), DEFVAL(0.0), DEFVAL(0.0));
+    ClassDB::bind_method(D_METHOD("get_tune_candidates"), &DracoMesh::get_tune_candidates);
+
+    ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "surfaces", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_STORAGE), "set_surfaces", "get_surfaces");
+    ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "materials", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_STORAGE), "set_materials", "get_materials");
+}
+
+//Default Constructor and destructor
+DracoMesh::DracoMesh() {}
+DracoMesh::~DracoMesh() {}
+
+void DracoMesh::set_surfaces(const Array &p_surfaces) {
+    std::lock_guard<std::mutex> lock(decode_mutex);
+    surfaces = p_surfaces;
+    mesh.unref();
+}
+
+Array DracoMesh::get_surfaces() const {
+    return surfaces;
+}
+
+void DracoMesh::set_materials(const Array &p_materials) {
+    std::lock_guard<std::mutex> lock(decode_mutex);
+    materials = p_materials;
+    mesh.unref();
+}
+
+Array DracoMesh::get_materials() const {
+    return materials;
+}
+
+void DracoMesh::add_surface(const PackedByteArray &p_data, const Ref<Material> &p_material) {
+    std::lock_guard<std::mutex> lock(decode_mutex);
+    surfaces.append(p_data);
+    materials.append(p_material);
+    mesh.unref();
+}
+
+int DracoMesh::get_surface_count() const {
+    return surfaces.size();
+}
+
+PackedByteArray DracoMesh::get_surface_data(int p_surface) const {
+    ERR_FAIL_INDEX_V(p_surface, surfaces.size(), PackedByteArray());
+    return surfaces[p_surface];
+}
+
+Ref<ArrayMesh> DracoMesh::get_mesh() {
+    std::lock_guard<std::mutex> lock(decode_mutex);
+    if (mesh.is_valid() || surfaces.is_empty()) {
+        return mesh;
+    }
+
+    Ref<ArrayMesh> decoded_mesh;
+    decoded_mesh.instantiate();
+    for (int i = 0; i < surfaces.size(); i++) {
+        Ref<ArrayMesh> surface_mesh = decode_buffer(surfaces[i]);
+        if (surface_mesh.is_null()) {
+            ERR_FAIL_V_MSG(nullptr, "Failed to decode DracoMesh surface " + String::num_int64(i));
+        }
+
+        decoded_mesh->add_surface_from_arrays(surface_mesh->surface_get_primitive_type(0), surface_mesh->surface_get_arrays(0));
+        if (i < materials.size()) {
+            Ref<Material> material = materials[i];
+            decoded_mesh->surface_set_material(i, material);
+        }
+    }
+
+    mesh = decoded_mesh;
+    return mesh;
+}
+
+bool DracoMesh::is_decoded() {
+    std::lock_guard<std::mutex> lock(decode_mutex);
+    return mesh.is_valid();
+}
+
+void DracoMesh::clear_decoded() {
+    std::lock_guard<std::mutex> lock(decode_mutex);
+    mesh.unref();
+}
+
+//Re-encodes an ArrayMesh so it can be stored and shipped compressed
+Ref<DracoMesh> DracoMesh::compress(const Ref<ArrayMesh> &p_mesh, int p_compression_level, int p_position_bits, int p_normal_bits, int p_uv_bits) {
+    return compress_surfaces(p_mesh, [&](const Array &p_arrays) {
+        return encode_arrays(p_arrays, p_compression_level, p_position_bits, p_normal_bits, p_uv_bits);
+    });
+}
+
+Ref<DracoMesh> DracoMesh::compress_tuned(const Ref<ArrayMesh> &p_mesh, float p_max_position_error, float p_max_uv_error, float p_max_decode_msec) {
+    Array candidates;
+    Ref<DracoMesh> draco_mesh = compress_surfaces(p_mesh, [&](const Array &p_arrays) {
+        Array surface_candidates;
+        PackedByteArray buffer = encode_arrays_tuned(p_arrays, p_max_position_error, p_max_uv_error, p_max_decode_msec, &surface_candidates);
+        candidates.append(surface_candidates);
+        return buffer;
+    });
+    if (draco_mesh.is_valid()) {
+        draco_mesh->tune_candidates = candidates;
+    }
+    return draco_mesh;
+}
+
+Array DracoMesh::get_tune_candidates() const {
+    return tune_candidates;
+}
+
+Ref<DracoMesh> DracoMesh::compress_surfaces(const Ref<ArrayMesh> &p_mesh, const std::function<PackedByteArray(const Array &)> &p_encode) {
+    ERR_FAIL_COND_V_MSG(p_mesh.is_null(), nullptr, "Can't compress a null mesh.");
+    ERR_FAIL_COND_V_MSG(p_mesh->get_blend_shape_count() > 0, nullptr, "Meshes with blend shapes can't be Draco compressed.");
+
+    Ref<DracoMesh> draco_mesh;
+    draco_mesh.instantiate();
+    draco_mesh->set_name(p_mesh->get_name());
+
+    for (int i = 0; i < p_mesh->get_surface_count(); i++) {
+        if (p_mesh->surface_get_primitive_type(i) != Mesh::PRIMITIVE_TRIANGLES) {
+            ERR_FAIL_V_MSG(nullptr, "Only triangle surfaces can be Draco compressed (surface " + String::num_int64(i) + ").");
+        }
+
+        PackedByteArray buffer = p_encode(p_mesh->surface_get_arrays(i));
+        if (buffer.is_empty()) {
+            ERR_FAIL_V_MSG(nullptr, "Failed to compress surface " + String::num_int64(i) + ".");
+        }
+        draco_mesh->add_surface(buffer, p_mesh->surface_get_material(i));
+    }
+
+    return draco_mesh;
+}
+
+// Function that handles calling the Draco Encoder for one surface
+PackedByteArray DracoMesh::encode_arrays(const Array &p_arrays, int p_compression_level, int p_position_bits, int p_normal_bits, int p_uv_bits) {
+    //Unchanged surfaces are served from the export cache without running the encoder
+    String cache_key;
+    if (DracoEncodeCache::is_enabled()) {
+        PackedInt32Array settings;
+        settings.append(p_compression_level);
+        settings.append(p_position_bits);
+        settings.append(p_normal_bits);
+        settings.append(p_uv_bits);
+        cache_key = DracoEncodeCache::get_key(p_arrays, settings);
+
+        PackedByteArray cached = DracoEncodeCache::load(cache_key);
+        if (!cached.is_empty()) {
+            return cached;
+        }
+    }
+
+    Encoder *encoder = create_surface_encoder(p_arrays, p_position_bits, p_normal_bits, p_uv_bits);
+    if (!encoder) {
+        return PackedByteArray();
+    }
+    encoderSetCompressionLevel(encoder, p_compression_level);
+
+    if (!encoderEncode(encoder, 0)) {
+        encoderRelease(encoder);
+        ERR_FAIL_V_MSG(PackedByteArray(), "Failed to encode Draco buffer");
+    }
+
+    PackedByteArray buffer = take_encoded_buffer(encoder);
+    if (!cache_key.is_empty()) {
+        DracoEncodeCache::store(cache_key, buffer);
+    }
+    return buffer;
+}
+
+//The encoder also logs the size, error and decode time of every candidate it tried
+PackedByteArray DracoMesh::encode_arrays_tuned(const Array &p_arrays, float p_max_position_error, float p_max_uv_error, float p_max_decode_msec, Array *r_candidates) {
+    //Bits without an error limit and the normal bits are the same as for compress and .drc saving
+    ProjectSettings *settings = ProjectSettings::get_singleton();
+    Encoder *encoder = create_surface_encoder(p_arrays,
+            settings->get_setting("gddraco/encoder/position_bits", 14),
+            settings->get_setting("gddraco/encoder/normal_bits", 10),
+            settings->get_setting("gddraco/encoder/uv_bits", 12));
+    if (!encoder) {
+        return PackedByteArray();
+    }
+
+    const bool tuned = encoderAutoTune(encoder, p_max_position_error, p_max_uv_error, p_max_decode_msec, 0);
+    if (r_candidates) {
+        const uint32_t candidate_count = encoderGetTuneCandidateCount(encoder);
+        for (uint32_t i = 0; i < candidate_count; i++) {
+            EncoderTuneCandidate candidate;
+            if (!encoderGetTuneCandidate(encoder, i, &candidate)) {
+                continue;
+            }
+            Dictionary info;
+            info["compression_level"] = candidate.compressionLevel;
+            info["position_bits"] = candidate.positionBits;
+            info["uv_bits"] = candidate.uvBits;
+            info["bytes"] = candidate.byteLength;
+            info["position_max_error"] = candidate.positionMaxError;
+            info["position_rms_error"] = candidate.positionRmsError;
+            info["uv_max_error"] = candidate.uvMaxError;
+            info["decode_msec"] = candidate.decodeMilliseconds;
+            info["valid"] = candidate.valid;
+            info["selected"] = candidate.selected;
+            r_candidates->append(info);
+        }
+    }
+    if (!tuned) {
+        encoderRelease(encoder);
+        ERR_FAIL_V_MSG(PackedByteArray(), "No Draco encoder settings meet the requested limits");
+    }
+
+    return take_encoded_buffer(encoder);
+}
+
+Encoder *DracoMesh::create_surface_encoder(const Array &p_arrays, int p_position_bits, int p_normal_bits, int p_uv_bits) {
+    PackedVector3Array positions = p_arrays[Mesh::ARRAY_VERTEX];
+    ERR_FAIL_COND_V_MSG(positions.is_empty(), nullptr, "Surface has no vertices.");
+    const uint32_t vertex_count = positions.size();
+
+    //Non indexed surfaces get a trivial index buffer
+    PackedInt32Array indices = p_arrays[Mesh::ARRAY_INDEX];
+    if (indices.is_empty()) {
+        indices.resize(vertex_count);
+        int32_t *dst = indices.ptrw();
+        for (uint32_t i = 0; i < vertex_count; i++) {
+            dst[i] = static_cast<int32_t>(i);
+        }
+    }
+    ERR_FAIL_COND_V_MSG(indices.size() % 3 != 0, nullptr, "Index count is not a multiple of 3.");
+
+    //Fail instead of silently dropping data that decode_buffer can't restore
+    for (int i = Mesh::ARRAY_CUSTOM0; i <= Mesh::ARRAY_CUSTOM3; i++) {
+        ERR_FAIL_COND_V_MSG(has_surface_array(p_arrays, i), nullptr, "Surfaces with custom arrays can't be Draco compressed.");
+    }
+    PackedFloat32Array tangents = p_arrays[Mesh::ARRAY_TANGENT];
+    PackedColorArray colors = p_arrays[Mesh::ARRAY_COLOR];
+    PackedVector2Array uv2s = p_arrays[Mesh::ARRAY_TEX_UV2];
+    PackedInt32Array bones = p_arrays[Mesh::ARRAY_BONES];
+    PackedFloat32Array weights = p_arrays[Mesh::ARRAY_WEIGHTS];
+    const int64_t skin_element_count = static_cast<int64_t>(vertex_count) * 4;
+    ERR_FAIL_COND_V_MSG(!tangents.is_empty() && tangents.size() != static_cast<int64_t>(vertex_count) * 4, nullptr, "Tangent count doesn't match the vertex count.");
+    ERR_FAIL_COND_V_MSG(!colors.is_empty() && colors.size() != vertex_count, nullptr, "Color count doesn't match the vertex count.");
+    ERR_FAIL_COND_V_MSG(!uv2s.is_empty() && uv2s.size() != vertex_count, nullptr, "UV2 count doesn't match the vertex count.");
+    ERR_FAIL_COND_V_MSG((!bones.is_empty() || !weights.is_empty()) && (bones.size() != skin_element_count || weights.size() != skin_element_count), nullptr, "Only surfaces with 4 bone weights per vertex can be Draco compressed.");
+
+    Encoder *encoder = encoderCreate(vertex_count);
+    if (!encoder) {
+        ERR_FAIL_V_MSG(nullptr, "Failed to create Draco encoder");
+    }
+    encoderSetQuantizationBits(encoder, p_position_bits, p_normal_bits, p_uv_bits, 10, 12);
+    encoderSetIndices(encoder, 5125, indices.size(), (void *)indices.ptr()); // 5125 = unsigned int indices
+
+    encoderSetAttribute(encoder, (char *)"POSITION", 5126, (char *)"VEC3", (void *)positions.ptr(), false);
+
+    PackedVector3Array normals = p_arrays[Mesh::ARRAY_NORMAL];
+    if (normals.size() == vertex_count) {
+        encoderSetAttribute(encoder, (char *)"NORMAL", 5126, (char *)"VEC3", (void *)normals.ptr(), false);
+    }
+
+    //Like skinning data, tangents, colors and UV2 are named so decode_buffer only reads them back from its own files
+    if (!tangents.is_empty()) {
+        uint32_t tangent_id = encoderSetAttribute(encoder, (char *)"TANGENT", 5126, (char *)"VEC4", (void *)tangents.ptr(), false);
+        encoderSetAttributeName(encoder, tangent_id, (char *)"TANGENT");
+    }
+
+    if (!colors.is_empty()) {
+        uint32_t color_id = encoderSetAttribute(encoder, (char *)"COLOR_0", 5126, (char *)"VEC4", (void *)colors.ptr(), false);
+        encoderSetAttributeName(encoder, color_id, (char *)"COLOR_0");
+    }
+
+    PackedVector2Array uvs = p_arrays[Mesh::ARRAY_TEX_UV];
+    if (uvs.size() == vertex_count) {
+        encoderSetAttribute(encoder, (char *)"TEXCOORD_0", 5126, (char *)"VEC2", (void *)uvs.ptr(), false);
+    }
+
+    if (!uv2s.is_empty()) {
+        uint32_t uv2_id = encoderSetAttribute(encoder, (char *)"TEXCOORD_1", 5126, (char *)"VEC2", (void *)uv2s.ptr(), false);
+        encoderSetAttributeName(encoder, uv2_id, (char *)"TEXCOORD_1");
+    }
+
+    //Skinning data is stored as named GENERIC attributes so decode_buffer can find it again
+    if (!bones.is_empty()) {
+        std::vector<uint16_t> joints(skin_element_count);
+        const int32_t *src_bone = bones.ptr();
+        for (int64_t i = 0; i < skin_element_count; i++) {
+            joints[i] = static_cast<uint16_t>(src_bone[i]);
+        }
+
+        uint32_t joints_id = encoderSetAttribute(encoder, (char *)"JOINTS_0", 5123, (char *)"VEC4", joints.data(), false);
+        encoderSetAttributeName(encoder, joints_id, (char *)"JOINTS_0");
+        uint32_t weights_id = encoderSetAttribute(encoder, (char *)"WEIGHTS_0", 5126, (char *)"VEC4", (void *)weights.ptr(), false);
+        encoderSetAttributeName(encoder, weights_id, (char *)"WEIGHTS_0");
+    }
+
+    return encoder;
+}
+
+PackedByteArray DracoMesh::take_encoded_buffer(Encoder *p_encoder) {
+    PackedByteArray buffer;
+    buffer.resize(encoderGetByteLength(p_encoder));
+    encoderCopy(p_encoder, buffer.ptrw());
+    encoderRelease(p_encoder);
+
+    return buffer;
+}
+
+// Decodes a .drc buffer, there are no glTF accessors so the attribute ids come from the Draco attribute types
+Ref<ArrayMesh> DracoMesh::decode_buffer(const PackedByteArray &compressed_buffer) {
+    Decoder *decoder = decoderCreate();
+    if (!decoder) {
+        ERR_FAIL_V_MSG(nullptr, "Failed to create Draco decoder");
+    }
+    //An empty list keeps only the positions, the other ids below are then not found
+    if (GDDraco::decode_positions_only()) {
+        const uint32_t no_ids[1] = {};
+        decoderSetAttributesToDecode(decoder, no_ids, 0);
+    }
+
+    if (!decoderDecode(decoder, (void *)compressed_buffer.ptr(), compressed_buffer.size())) {
+        decoderRelease(decoder);
+        ERR_FAIL_V_MSG(nullptr, "Failed to decode Draco buffer");
+    }
+
+    int position_id = decoderGetAttributeIdByType(decoder, (char *)"POSITION", 0);
+    int normal_id = decoderGetAttributeIdByType(decoder, (char *)"NORMAL", 0);
+    int uv_id = decoderGetAttributeIdByType(decoder, (char *)"TEXCOORD", 0);
+    int color_id = decoderGetAttributeIdByName(decoder, (char *)"COLOR_0");
+    int tangent_id = decoderGetAttributeIdByName(decoder, (char *)"TANGENT");
+    //Without a first UV set the UV2 written by encode_arrays is the first texture coordinate attribute
+    int uv2_id = decoderGetAttributeIdByName(decoder, (char *)"TEXCOORD_1");
+    if (uv2_id >= 0 && uv2_id == uv_id) {
+        uv_id = -1;
+    }
+
+    // Skinning data is stored as GENERIC attributes, it's only used when it was named by encode_arrays
+    int joints_id = decoderGetAttributeIdByName(decoder, (char *)"JOINTS_0");
+    int weights_id = decoderGetAttributeIdByName(decoder, (char *)"WEIGHTS_0");
+    if (joints_id < 0 || weights_id < 0) {
+        joints_id = -3;
+        weights_id = -4;
+    }
+
+    Ref<ArrayMesh> mesh = GDDraco::convert_draco_mesh(decoder, position_id, normal_id, uv_id, joints_id, weights_id);
+    if (mesh.is_null() || (color_id < 0 && tangent_id < 0 && uv2_id < 0)) {
+        decoderRelease(decoder);
+        return mesh;
+    }
+
+    //The arrays convert_draco_mesh doesn't know about are added to its surface
+    const uint32_t vertex_count = decoderGetVertexCount(decoder);
+    const Mesh::PrimitiveType primitive_type = mesh->surface_get_primitive_type(0);
+    Array arrays = mesh->surface_get_arrays(0);
+    PackedFloat32Array tangents;
+    if (tangent_id >= 0 && copy_float_attribute(decoder, tangent_id, "VEC4", vertex_count * 4, tangents)) {
+        arrays[Mesh::ARRAY_TANGENT] = tangents;
+    }
+    PackedColorArray colors;
+    if (color_id >= 0 && copy_float_attribute(decoder, color_id, "VEC4", vertex_count, colors)) {
+        arrays[Mesh::ARRAY_COLOR] = colors;
+    }
+    PackedVector2Array uv2s;
+    if (uv2_id >= 0 && copy_float_attribute(decoder, uv2_id, "VEC2", vertex_count, uv2s)) {
+        arrays[Mesh::ARRAY_TEX_UV2] = uv2s;
+    }
+    decoderRelease(decoder);
+
+    mesh->clear_surfaces();
+    mesh->add_surface_from_arrays(primitive_type, arrays);
+    return mesh;
+}
+
+//Only materials saved as their own resource can be referenced from a .dracomesh file
+static bool is_embedded_material(const Ref<Material> &p_material) {
+    if (p_material.is_null()) {
+        return false;
+    }
+    const String path = p_material->get_path();
+    return !path.begins_with("res://") || path.contains("::");
+}
+
+bool DracoMesh::has_embedded_materials() const {
+    for (int i = 0; i < materials.size(); i++) {
+        if (is_embedded_material(materials[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+PackedByteArray DracoMesh::get_file_buffer() const {
+    Ref<StreamPeerBuffer> stream;
+    stream.instantiate();
+
+    stream->put_data(String(DRACOMESH_MAGIC).to_ascii_buffer());
+    stream->put_32(DRACOMESH_VERSION);
+    stream->put_32(surfaces.size());
+    for (int i = 0; i < surfaces.size(); i++) {
+        const PackedByteArray data = surfaces[i];
+        stream->put_32(data.size());
+        stream->put_data(data);
+
+        Ref<Material> material;
+        if (i < materials.size()) {
+            material = materials[i];
+        }
+        String material_path;
+        if (is_embedded_material(material)) {
+            WARN_PRINT("Surface " + String::num_int64(i) + " of " + get_name() + " uses an embedded material, which is not saved.");
+        } else if (material.is_valid()) {
+            material_path = material->get_path();
+        }
+        //Same layout as FileAccess::store_pascal_string, a 32 bit byte count followed by UTF-8
+        stream->put_utf8_string(material_path);
+    }
+
+    return stream->get_data_array();
+}
+
+Error DracoMesh::save_file(const String &p_path) const {
+    Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE);
+    ERR_FAIL_COND_V_MSG(file.is_null(), ERR_FILE_CANT_WRITE, "Failed to open " + p_path + " for writing.");
+
+    file->store_buffer(get_file_buffer());
+    return file->get_error() == OK ? OK : ERR_FILE_CANT_WRITE;
+}
+
+Ref<DracoMesh> DracoMesh::load_file(const String &p_path) {
+    Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
+    ERR_FAIL_COND_V_MSG(file.is_null(), nullptr, "Failed to open " + p_path + " for reading.");
+    const int64_t surface_count = read_dracomesh_header(file);
+    ERR_FAIL_COND_V_MSG(surface_count < 0, nullptr, p_path + " is not a .dracomesh file.");
+
+    Ref<DracoMesh> draco_mesh;
+    draco_mesh.instantiate();
+    for (int64_t i = 0; i < surface_count; i++) {
+        const uint32_t size = file->get_32();
+        const PackedByteArray data = file->get_buffer(size);
+        ERR_FAIL_COND_V_MSG(data.size() != size, nullptr, p_path + " is truncated.");
+
+        Ref<Material> material;
+        const String material_path = file->get_pascal_string();
+        if (!material_path.is_empty()) {
+            material = ResourceLoader::get_singleton()->load(material_path);
+        }
+        draco_mesh->add_surface(data, material);
+    }
+
+    return draco_mesh;
+}
+
+PackedStringArray DracoMesh::get_file_dependencies(const String &p_path) {
+    PackedStringArray dependencies;
+    Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
+    if (file.is_null()) {
+        return dependencies;
+    }
+    const int64_t surface_count = read_dracomesh_header(file);
+    for (int64_t i = 0; i < surface_count && !file->eof_reached(); i++) {
+        const uint32_t size = file->get_32();
+        file->seek(file->get_position() + size);
+        const String material_path = file->get_pascal_string();
+        if (!material_path.is_empty() && !dependencies.has(material_path)) {
+            dependencies.append(material_path);
+        }
+    }
+
+    return dependencies;
+}
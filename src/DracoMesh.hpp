@@ -0,0 +1,113 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 itslebi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef DRACO_MESH_HPP
+#define DRACO_MESH_HPP
+
+#include <godot_cpp/classes/resource.hpp>
+#include <godot_cpp/classes/array_mesh.hpp>
+#include <godot_cpp/classes/material.hpp>
+
+#include <functional>
+#include <mutex>
+
+struct Encoder;
+
+namespace godot {
+    //Resource that keeps its surfaces Draco-compressed and only decodes them on first access
+    class DracoMesh: public Resource {
+        GDCLASS(DracoMesh, Resource);
+
+        private:
+            Array surfaces;
+            Array materials;
+            //Candidates tried by compress_tuned, one Array of Dictionaries per surface (not saved)
+            Array tune_candidates;
+            Ref<ArrayMesh> mesh;
+            std::mutex decode_mutex;
+
+            static Ref<DracoMesh> compress_surfaces(const Ref<ArrayMesh> &p_mesh, const std::function<PackedByteArray(const Array &)> &p_encode);
+            //Creates an encoder holding the attributes of the surface, returns nullptr on failure
+            static Encoder *create_surface_encoder(const Array &p_arrays, int p_position_bits, int p_normal_bits, int p_uv_bits);
+            //Copies the encoded bytes out and releases the encoder
+            static PackedByteArray take_encoded_buffer(Encoder *p_encoder);
+
+        protected:
+            static void _bind_methods();
+
+        public:
+            DracoMesh();
+            ~DracoMesh();
+
+            void set_surfaces(const Array &p_surfaces);
+            Array get_surfaces() const;
+
+            void set_materials(const Array &p_materials);
+            Array get_materials() const;
+
+            //Adds an already compressed Draco buffer as a new surface
+            void add_surface(const PackedByteArray &p_data, const Ref<Material> &p_material);
+            int get_surface_count() const;
+            PackedByteArray get_surface_data(int p_surface) const;
+
+            //Decodes the surfaces the first time it is called and returns the cached mesh afterwards (thread safe)
+            Ref<ArrayMesh> get_mesh();
+            bool is_decoded();
+
+            //Drops the decoded mesh so only the compressed bytes stay resident
+            void clear_decoded();
+
+            //Re-encodes every surface of an ArrayMesh with the Draco encoder, fails on blend shapes and custom arrays
+            static Ref<DracoMesh> compress(const Ref<ArrayMesh> &p_mesh, int p_compression_level, int p_position_bits, int p_normal_bits, int p_uv_bits);
+
+            //Like compress, but picks the quantization bits and compression level giving the smallest surfaces
+            //within the error limits (in mesh and UV units) and decode time budget, non-positive limits are ignored.
+            //Bits that aren't tuned come from the gddraco/encoder/ project settings
+            static Ref<DracoMesh> compress_tuned(const Ref<ArrayMesh> &p_mesh, float p_max_position_error, float p_max_uv_error, float p_max_decode_msec);
+            //Size, quantization error and decode time of every candidate compress_tuned tried for each surface
+            Array get_tune_candidates() const;
+
+            //Encodes the arrays of a single triangle surface, returns an empty buffer on failure
+            static PackedByteArray encode_arrays(const Array &p_arrays, int p_compression_level, int p_position_bits, int p_normal_bits, int p_uv_bits);
+            //When r_candidates is not null it receives one Dictionary per tried candidate, see get_tune_candidates
+            static PackedByteArray encode_arrays_tuned(const Array &p_arrays, float p_max_position_error, float p_max_uv_error, float p_max_decode_msec, Array *r_candidates = nullptr);
+
+            //Decodes a standalone Draco buffer, finding the attributes by their semantic type
+            static Ref<ArrayMesh> decode_buffer(const PackedByteArray &compressed_buffer);
+
+            //Writes the compressed surfaces and the paths of their materials to a .dracomesh file, embedded materials
+            //are not kept. Unlike a DracoMesh .res, the file loads as an ArrayMesh (see DracoLoader)
+            Error save_file(const String &p_path) const;
+            //Contents of the .dracomesh file save_file writes
+            PackedByteArray get_file_buffer() const;
+            //Returns if a material isn't saved as its own resource and would be dropped by save_file
+            bool has_embedded_materials() const;
+            //Reads a .dracomesh file without decoding its surfaces, returns null on failure
+            static Ref<DracoMesh> load_file(const String &p_path);
+            //Returns the paths of the materials used by a .dracomesh file
+            static PackedStringArray get_file_dependencies(const String &p_path);
+    };
+}
+
+#endif //DRACO_MESH_HPP
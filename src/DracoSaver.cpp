@@ -0,0 +1,78 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 itslebi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "DracoSaver.hpp"
+#include "DracoMesh.hpp"
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/project_settings.hpp>
+
+using namespace godot;
+
+void DracoSaver::_bind_methods() {}
+
+//Default Constructor and destructor
+DracoSaver::DracoSaver() {}
+DracoSaver::~DracoSaver() {}
+
+bool DracoSaver::_recognize(const Ref<Resource> &p_resource) const {
+    return Object::cast_to<DracoMesh>(p_resource.ptr()) != nullptr || Object::cast_to<ArrayMesh>(p_resource.ptr()) != nullptr;
+}
+
+PackedStringArray DracoSaver::_get_recognized_extensions(const Ref<Resource> &p_resource) const {
+    PackedStringArray extensions;
+    if (_recognize(p_resource)) {
+        extensions.append("drc");
+        extensions.append("dracomesh");
+    }
+    return extensions;
+}
+
+Error DracoSaver::_save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags) {
+    Ref<DracoMesh> draco_mesh = p_resource;
+
+    //ArrayMeshes are re-encoded with the project's encoder settings
+    if (draco_mesh.is_null()) {
+        ProjectSettings *settings = ProjectSettings::get_singleton();
+        draco_mesh = DracoMesh::compress(p_resource,
+                settings->get_setting("gddraco/encoder/compression_level", 7),
+                settings->get_setting("gddraco/encoder/position_bits", 14),
+                settings->get_setting("gddraco/encoder/normal_bits", 10),
+                settings->get_setting("gddraco/encoder/uv_bits", 12));
+        ERR_FAIL_COND_V(draco_mesh.is_null(), ERR_INVALID_DATA);
+    }
+
+    if (p_path.get_extension().to_lower() == "dracomesh") {
+        return draco_mesh->save_file(p_path);
+    }
+
+    //A .drc file holds exactly one Draco mesh
+    ERR_FAIL_COND_V_MSG(draco_mesh->get_surface_count() != 1, ERR_INVALID_PARAMETER, "A .drc file can only hold a single surface, save multi-surface meshes as .dracomesh instead.");
+
+    Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE);
+    ERR_FAIL_COND_V_MSG(file.is_null(), ERR_FILE_CANT_WRITE, "Failed to open " + p_path + " for writing.");
+    file->store_buffer(draco_mesh->get_surface_data(0));
+
+    return OK;
+}
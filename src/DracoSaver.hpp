@@ -0,0 +1,49 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 itslebi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef DRACO_SAVER_HPP
+#define DRACO_SAVER_HPP
+
+#include <godot_cpp/classes/resource_format_saver.hpp>
+
+namespace godot {
+    //Saves single surface ArrayMesh and DracoMesh resources as standalone .drc files and meshes with any number of
+    //surfaces as .dracomesh files
+    class DracoSaver: public ResourceFormatSaver {
+        GDCLASS(DracoSaver, ResourceFormatSaver);
+
+        protected:
+            static void _bind_methods();
+
+        public:
+            DracoSaver();
+            ~DracoSaver();
+
+            Error _save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags) override;
+            bool _recognize(const Ref<Resource> &p_resource) const override;
+            PackedStringArray _get_recognized_extensions(const Ref<Resource> &p_resource) const override;
+    };
+}
+
+#endif //DRACO_SAVER_HPP
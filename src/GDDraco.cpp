@@ -23,10 +23,103 @@
  */
 
 #include "GDDraco.hpp"
+#include "GeometryHash.hpp"
+#include "ParallelFor.hpp"
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/project_settings.hpp>
+
+#include "draco/core/memory_resource.h"
+#include "draco/core/trace.h"
+#include "draco/core/vector_kernels.h"
+
+#include <mutex>
+#include <unordered_map>
 
 using namespace godot;
 
-void GDDraco::_bind_methods() {} //only required to allow methods to be called from GDScript
+//Memory stats of the last import, kept as plain data since Godot types can't be created before the extension is initialized
+struct ImportMemoryStats {
+    struct Primitive {
+        int mesh;
+        int surface;
+        PrimitiveMemoryStats stats;
+    };
+    std::vector<Primitive> primitives;
+    uint64_t draco_peak_bytes = 0;
+};
+
+static std::mutex last_import_memory_stats_mutex;
+static ImportMemoryStats last_import_memory_stats;
+
+//Keeps the memory stats of an import for get_last_import_memory_stats and prints their totals
+static void record_import_memory_stats(const std::vector<std::vector<PrimitiveData>> &p_meshes, uint64_t p_draco_peak_bytes) {
+    ImportMemoryStats stats;
+    PrimitiveMemoryStats total;
+    for (int i = 0; i < (int)p_meshes.size(); i++) {
+        for (int t = 0; t < (int)p_meshes[i].size(); t++) {
+            stats.primitives.push_back({i, t, p_meshes[i][t].memory_stats});
+            total.merge(p_meshes[i][t].memory_stats);
+        }
+    }
+    stats.draco_peak_bytes = p_draco_peak_bytes;
+
+    UtilityFunctions::print("GDDraco: memory of ", (int64_t)stats.primitives.size(), " primitives, Draco peak ", String::humanize_size(p_draco_peak_bytes));
+    Dictionary stages = total.to_dictionary();
+    Array stage_names = stages.keys();
+    for (int64_t i = 0; i < stage_names.size(); i++) {
+        Dictionary stage = stages[stage_names[i]];
+        UtilityFunctions::print("  ", stage_names[i], ": ", stage["allocations"], " allocations, ", String::humanize_size(stage["bytes"]), ", peak ", String::humanize_size(stage["peak_bytes"]));
+    }
+
+    std::lock_guard<std::mutex> lock(last_import_memory_stats_mutex);
+    last_import_memory_stats = std::move(stats);
+}
+
+//Key of a mesh for deduplication, meshes with the same primitives in the same order and with the same materials match
+static uint64_t mesh_geometry_key(const std::vector<PrimitiveData> &p_primitives) {
+    uint64_t key = p_primitives.size();
+    for (const PrimitiveData &prim : p_primitives) {
+        key = hash_combine_u64(key, prim.geometry_hash);
+        key = hash_combine_u64(key, static_cast<uint64_t>(prim.material_Idx));
+    }
+    return key;
+}
+
+//Confirms a key match, the primitives must have the same materials and the same geometry in the same order
+static bool is_same_mesh(const std::vector<PrimitiveData> &p_primitives_a, const std::vector<PrimitiveData> &p_primitives_b) {
+    if (p_primitives_a.size() != p_primitives_b.size()) {
+        return false;
+    }
+    for (size_t t = 0; t < p_primitives_a.size(); t++) {
+        const PrimitiveData &prim_a = p_primitives_a[t];
+        const PrimitiveData &prim_b = p_primitives_b[t];
+        if (prim_a.material_Idx != prim_b.material_Idx || prim_a.geometry_hash != prim_b.geometry_hash) {
+            return false;
+        }
+        if (!is_same_geometry(prim_a.primitive, prim_b.primitive)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//Writes the zones recorded so far, imports running at the same time may write the same file
+static std::mutex trace_file_mutex;
+
+static Error write_trace(const String &p_path) {
+    std::lock_guard<std::mutex> lock(trace_file_mutex);
+    Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE);
+    ERR_FAIL_COND_V_MSG(file.is_null(), ERR_FILE_CANT_WRITE, "Failed to open " + p_path + " for writing.");
+    file->store_string(String::utf8(draco::Trace::ToChromeTraceJson().c_str()));
+    return OK;
+}
+
+void GDDraco::_bind_methods() {
+    ClassDB::bind_static_method("GDDraco", D_METHOD("get_last_import_memory_stats"), &GDDraco::get_last_import_memory_stats);
+    ClassDB::bind_static_method("GDDraco", D_METHOD("start_trace"), &GDDraco::start_trace);
+    ClassDB::bind_static_method("GDDraco", D_METHOD("stop_trace", "path"), &GDDraco::stop_trace);
+}
 
 //Default Constructor and destructor
 GDDraco::GDDraco() {}
@@ -57,6 +150,19 @@ Error GDDraco::_import_preflight(const Ref<GLTFState> &p_state, const PackedStri
 //Our Importing Logic
 Error GDDraco::_import_post_parse(const Ref<GLTFState> &p_state) {
     //UtilityFunctions::print("GDDraco::_import_post_parse called!");
+    const bool track_memory = memory_stats_enabled();
+    const bool deduplicate = ProjectSettings::get_singleton()->get_setting("gddraco/import/deduplicate_meshes", false);
+    const bool cleanup = cleanup_meshes();
+    const bool strips = use_triangle_strips();
+    const bool lods = generate_lods();
+
+#ifdef DRACO_TRACE_SUPPORTED
+    //With a trace file set, recording starts with the first import and every import rewrites the file with everything recorded so far
+    const String trace_file = ProjectSettings::get_singleton()->get_setting("gddraco/debug/trace_file", "");
+    if (!trace_file.is_empty() && !draco::Trace::IsRecording()) {
+        draco::Trace::Start();
+    }
+#endif
 
     // Get buffer views from GLTFState
     TypedArray<Ref<GLTFBufferView>> buffer_views = p_state->get_buffer_views();
@@ -68,12 +174,17 @@ Error GDDraco::_import_post_parse(const Ref<GLTFState> &p_state) {
     }
     Array arr_meshes = json["meshes"];
 
-    //For each of the meshes decode each of their primitives
+    //Primitives of every mesh, gathered first so they can all be decoded in parallel
+    std::vector<std::vector<PrimitiveData>> vec_meshes(arr_meshes.size());
+    std::vector<String> vec_mesh_names(arr_meshes.size());
+    std::vector<bool> vec_mesh_valid(arr_meshes.size(), false);
+
+    //For each of the meshes gather each of their primitives
     for (int i = 0; i < (int)arr_meshes.size(); i++) {
         Dictionary dic_mesh = arr_meshes[i];
 
         //Create a vector to have all of the primitives per Mesh
-        std::vector<PrimitiveData> vec_primitives;
+        std::vector<PrimitiveData> &vec_primitives = vec_meshes[i];
 
         //Get the data on mesh primitives
         if (!dic_mesh.has("primitives")) {
@@ -81,12 +192,14 @@ Error GDDraco::_import_post_parse(const Ref<GLTFState> &p_state) {
             continue;
         }
         Array arr_primitives = dic_mesh["primitives"];
+        vec_mesh_valid[i] = true;
 
         //Get Mesh Name
         String mesh_name = "Mesh";
-        if (dic_mesh.has("primitives")) {
+        if (dic_mesh.has("name")) {
             mesh_name = dic_mesh["name"];
         }
+        vec_mesh_names[i] = mesh_name;
 
         //Go through each primitive
         for (int r = 0; r < (int)arr_primitives.size(); r++) {
@@ -125,68 +238,157 @@ Error GDDraco::_import_post_parse(const Ref<GLTFState> &p_state) {
             }
             Dictionary dic_attributes = dic_KHR_draco_mesh_compression["attributes"];
 
+            PrimitiveData primitive_data = PrimitiveData(-5, nullptr);
+            primitive_data.buffer = buffer;
+            if (track_memory) {
+                primitive_data.memory_stats.load.allocations = 1;
+                primitive_data.memory_stats.load.bytes = buffer.size();
+                primitive_data.memory_stats.load.peak_bytes = buffer.size();
+            }
+
             //GET ATTRIBUTES DATA
             if (!dic_attributes.has("POSITION")) {
                 UtilityFunctions::printerr("Skipping primitive " + String::num_int64(r) + " due to no POSITION key");
                 continue;
             }
-            int position_id = dic_attributes["POSITION"];
+            primitive_data.position_id = dic_attributes["POSITION"];
 
-            int normal_id = -1;
             if (dic_attributes.has("NORMAL")) {
-                normal_id = dic_attributes["NORMAL"];
+                primitive_data.normal_id = dic_attributes["NORMAL"];
             }
 
-            int uv_id = -2;
             if (dic_attributes.has("TEXCOORD_0")) {
-                uv_id = dic_attributes["TEXCOORD_0"];
+                primitive_data.uv_id = dic_attributes["TEXCOORD_0"];
             }
 
-            int joints_id = -3;
             if (dic_attributes.has("JOINTS_0")) {
-                joints_id = dic_attributes["JOINTS_0"];
+                primitive_data.joints_id = dic_attributes["JOINTS_0"];
             }
             
-            int weights_id = -4;
             if (dic_attributes.has("WEIGHTS_0")) {
-                weights_id = dic_attributes["WEIGHTS_0"];
+                primitive_data.weights_id = dic_attributes["WEIGHTS_0"];
             }
 
-            if (!dic_primitive.has("indices")) {
+            //Point clouds (mode 0 = POINTS) don't need indices
+            int mode = 4;
+            if (dic_primitive.has("mode")) {
+                mode = dic_primitive["mode"];
+            }
+
+            if (dic_primitive.has("indices")) {
+                primitive_data.indices_id = dic_primitive["indices"];
+            } else if (mode != 0) {
                 UtilityFunctions::printerr("Skipping primitive " + String::num_int64(r) + " due to no indices key");
                 continue;
             }
-            int indices_id = dic_primitive["indices"];
 
-            int material_Idx = -5;
             if (dic_primitive.has("material")) {
-                material_Idx = dic_primitive["material"];
+                primitive_data.material_Idx = dic_primitive["material"];
             }
 
-            //Decode Mesh
-            Ref<ArrayMesh> primitive = decode_draco_mesh(buffer, position_id, normal_id, uv_id, joints_id, weights_id, indices_id);
-            if (primitive == nullptr) {
-                return ERR_INVALID_DATA; 
-            }
-            //UtilityFunctions::print("Primitive Decoded!");
+            vec_primitives.push_back(primitive_data);
+        }
+    }
 
-            PrimitiveData primitive_data = PrimitiveData(material_Idx, primitive);
+    //Decode every primitive of every mesh on the WorkerThreadPool
+    std::vector<PrimitiveData *> vec_jobs;
+    for (std::vector<PrimitiveData> &vec_primitives : vec_meshes) {
+        for (PrimitiveData &prim : vec_primitives) {
+            vec_jobs.push_back(&prim);
+        }
+    }
 
-            vec_primitives.push_back(primitive_data);
+    //With memory stats, the Draco allocations of every primitive also go through one shared counter whose peak covers the primitives decoded at the same time
+    draco::CountingMemoryResource import_memory(draco::GetCurrentMemoryResource());
+    parallel_for(vec_jobs.size(), [&vec_jobs, &import_memory, track_memory, deduplicate, cleanup, strips, lods](uint32_t p_index) {
+        PrimitiveData *prim = vec_jobs[p_index];
+        draco::ScopedMemoryResource scoped_memory(track_memory ? &import_memory : draco::GetCurrentMemoryResource());
+        prim->primitive = decode_draco_mesh(prim->buffer, prim->position_id, prim->normal_id, prim->uv_id, prim->joints_id, prim->weights_id, prim->indices_id, track_memory ? &prim->memory_stats : nullptr, cleanup ? &prim->cleanup_stats : nullptr, strips ? &prim->strip_stats : nullptr, lods ? &prim->lods : nullptr);
+
+        //Drop the compressed copy as soon as possible, point clouds can be huge
+        prim->buffer = PackedByteArray();
+
+        if (deduplicate) {
+            prim->geometry_hash = compute_geometry_hash(prim->primitive);
+        }
+    }, "GDDraco: decoding primitives");
+
+    for (PrimitiveData *prim : vec_jobs) {
+        if (prim->primitive == nullptr) {
+            return ERR_INVALID_DATA; 
+        }
+    }
+
+    if (cleanup) {
+        uint64_t removed_vertices = 0;
+        uint64_t removed_faces = 0;
+        for (PrimitiveData *prim : vec_jobs) {
+            removed_vertices += prim->cleanup_stats.removed_vertices;
+            removed_faces += prim->cleanup_stats.removed_faces;
+        }
+        UtilityFunctions::print("GDDraco: cleanup of ", (int64_t)vec_jobs.size(), " primitives removed ", (int64_t)removed_vertices, " vertices and ", (int64_t)removed_faces, " faces");
+    }
+
+    if (lods) {
+        int64_t lod_count = 0;
+        for (PrimitiveData *prim : vec_jobs) {
+            lod_count += prim->lods.size();
         }
+        UtilityFunctions::print("GDDraco: generated ", lod_count, " levels of detail for ", (int64_t)vec_jobs.size(), " primitives");
+    }
+    //UtilityFunctions::print("Primitives Decoded!");
+
+    //Assign the mesh data so that it appears in godot
+    TypedArray<Ref<GLTFMesh>> meshes_mesh = p_state->get_meshes();
+    TypedArray<Ref<Material>> meshes_materials = p_state->get_materials();
+
+    //With deduplication, meshes matching an earlier mesh get its ImporterMesh instead of their own. Meshes with the
+    //same key but different geometry stay separate entries of the key
+    std::unordered_multimap<uint64_t, int> shared_meshes;
+    int shared_mesh_count = 0;
+
+    for (int i = 0; i < (int)arr_meshes.size(); i++) {
+        if (!vec_mesh_valid[i]) {
+            continue;
+        }
+        std::vector<PrimitiveData> &vec_primitives = vec_meshes[i];
+        const String &mesh_name = vec_mesh_names[i];
 
-        //Assign the mesh data so that it appears in godot
-        TypedArray<Ref<GLTFMesh>> meshes_mesh = p_state->get_meshes();
-        TypedArray<Ref<Material>> meshes_materials = p_state->get_materials();
         if (i >= 0 && i < meshes_mesh.size()) {
+            uint64_t mesh_key = 0;
+            if (deduplicate && !vec_primitives.empty()) {
+                mesh_key = mesh_geometry_key(vec_primitives);
+                int shared_mesh = -1;
+                auto candidates = shared_meshes.equal_range(mesh_key);
+                for (auto candidate = candidates.first; candidate != candidates.second; ++candidate) {
+                    if (is_same_mesh(vec_meshes[candidate->second], vec_primitives)) {
+                        shared_mesh = candidate->second;
+                        break;
+                    }
+                }
+                if (shared_mesh >= 0) {
+                    Ref<GLTFMesh> mesh_to_change = meshes_mesh[i];
+                    Ref<GLTFMesh> mesh_to_share = meshes_mesh[shared_mesh];
+                    mesh_to_change->set_original_name(mesh_name);
+                    mesh_to_change->set_mesh(mesh_to_share->get_mesh());
+                    shared_mesh_count++;
+
+                    //The decoded copy isn't needed anymore
+                    for (PrimitiveData &prim : vec_primitives) {
+                        prim.primitive.unref();
+                    }
+                    continue;
+                }
+            }
+
             //Create Importer Mesh
             Ref<ImporterMesh> importer_mesh;
             importer_mesh.instantiate();
 
             //Add all primitives to this ImporterMesh
             for (int t = 0; t < (int)vec_primitives.size(); t++) {
-                PrimitiveData prim = vec_primitives[t];
-                importer_mesh = add_primitive_to_importer_mesh(prim.primitive, importer_mesh);
+                PrimitiveData &prim = vec_primitives[t];
+                importer_mesh = add_primitive_to_importer_mesh(prim.primitive, importer_mesh, prim.lods, track_memory ? &prim.memory_stats.importer : nullptr);
 
                 if (prim.material_Idx >= 0) {
                     Ref<Material> mat = meshes_materials[prim.material_Idx];
@@ -194,6 +396,14 @@ Error GDDraco::_import_post_parse(const Ref<GLTFState> &p_state) {
                 }
 
                 importer_mesh->set_surface_name(t, mesh_name);
+
+                if (strips && prim.strip_stats.list_indices > 0) {
+                    if (prim.strip_stats.strip_indices > 0) {
+                        UtilityFunctions::print("GDDraco: ", mesh_name, " surface ", t, " uses triangle strips, ", (int64_t)prim.strip_stats.list_indices, " -> ", (int64_t)prim.strip_stats.strip_indices, " indices");
+                    } else {
+                        UtilityFunctions::print("GDDraco: ", mesh_name, " surface ", t, " keeps its triangle list of ", (int64_t)prim.strip_stats.list_indices, " indices, strips wouldn't be smaller");
+                    }
+                }
             }
 
             //UtilityFunctions::print("Created ImpoterMesh!");
@@ -201,17 +411,74 @@ Error GDDraco::_import_post_parse(const Ref<GLTFState> &p_state) {
             mesh_to_change->set_original_name(mesh_name);
             mesh_to_change->set_mesh(importer_mesh);
             //UtilityFunctions::print("Mesh is set!");
+
+            if (deduplicate && !vec_primitives.empty()) {
+                //Its decoded primitives are kept to compare the meshes after it
+                shared_meshes.emplace(mesh_key, i);
+            }
         }
     }
 
+    if (shared_mesh_count > 0) {
+        UtilityFunctions::print("GDDraco: ", shared_mesh_count, " of ", (int64_t)arr_meshes.size(), " meshes share the geometry of another mesh");
+    }
+
+    if (track_memory) {
+        record_import_memory_stats(vec_meshes, import_memory.peak_bytes());
+    }
+
+#ifdef DRACO_TRACE_SUPPORTED
+    if (!trace_file.is_empty()) {
+        write_trace(trace_file);
+    }
+#endif
+
     return OK;
 }
 
+Error GDDraco::start_trace() {
+#ifdef DRACO_TRACE_SUPPORTED
+    draco::Trace::Start();
+    return OK;
+#else
+    ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "GDDraco was built without trace=yes, there are no trace zones to record.");
+#endif
+}
+
+Error GDDraco::stop_trace(const String &path) {
+    ERR_FAIL_COND_V_MSG(!draco::Trace::IsRecording(), ERR_DOES_NOT_EXIST, "No trace is being recorded, call start_trace() first.");
+    draco::Trace::Stop();
+    return write_trace(path);
+}
+
+Dictionary GDDraco::get_last_import_memory_stats() {
+    std::lock_guard<std::mutex> lock(last_import_memory_stats_mutex);
+    Dictionary result;
+    if (last_import_memory_stats.primitives.empty()) {
+        return result;
+    }
+
+    Array primitives;
+    PrimitiveMemoryStats total;
+    for (const ImportMemoryStats::Primitive &primitive : last_import_memory_stats.primitives) {
+        Dictionary entry = primitive.stats.to_dictionary();
+        entry["mesh"] = primitive.mesh;
+        entry["surface"] = primitive.surface;
+        primitives.append(entry);
+        total.merge(primitive.stats);
+    }
+    result["primitives"] = primitives;
+    result["total"] = total.to_dictionary();
+    result["draco_peak_bytes"] = static_cast<int64_t>(last_import_memory_stats.draco_peak_bytes);
+    return result;
+}
+
 //Adds the passed primitive to the importer_mesh passsed
-Ref<ImporterMesh> GDDraco::add_primitive_to_importer_mesh(const Ref<ArrayMesh> &source_mesh, Ref<ImporterMesh> importer_mesh) {
+Ref<ImporterMesh> GDDraco::add_primitive_to_importer_mesh(const Ref<ArrayMesh> &source_mesh, Ref<ImporterMesh> importer_mesh, const Dictionary &lods, MemoryStageStats *r_memory_stats) {
 	if (source_mesh.is_null()) {
 		return importer_mesh;
 	}
+	DRACO_TRACE_ZONE("GDDraco::AssembleImporterMesh");
 
     // Get number of blend shapes and surfaces (Same for all ArrayMeshes)
     int blend_shape_count = source_mesh->get_blend_shape_count();
@@ -247,12 +514,17 @@ Ref<ImporterMesh> GDDraco::add_primitive_to_importer_mesh(const Ref<ArrayMesh> &
             blend_shapes = source_mesh->surface_get_blend_shape_arrays(i);
         }
 
+		//The arrays are copies of the ArrayMesh surface, the ImporterMesh keeps them
+		if (r_memory_stats) {
+			r_memory_stats->merge(surface_arrays_memory(arrays));
+		}
+
 		// 4. Add to ImporterMesh
 		importer_mesh->add_surface(
 			primitive_type,
 			arrays,
 			blend_shapes,
-			Dictionary(), // LODs – not used here
+			lods, // LODs – empty unless generated after decoding
 			material,
 			name,
 			0 // flags
@@ -264,8 +536,9 @@ Ref<ImporterMesh> GDDraco::add_primitive_to_importer_mesh(const Ref<ArrayMesh> &
 
 
 // Function that handles calling the Draco Decoder
-Ref<ArrayMesh> GDDraco::decode_draco_mesh(const PackedByteArray &compressed_buffer, int position_id, int normal_id, int uv_id, int joints_id, int weights_id, int indices_id) {
+Ref<ArrayMesh> GDDraco::decode_draco_mesh(const PackedByteArray &compressed_buffer, int position_id, int normal_id, int uv_id, int joints_id, int weights_id, int indices_id, PrimitiveMemoryStats *r_memory_stats, CleanupStats *r_cleanup_stats, StripStats *r_strip_stats, Dictionary *r_lods) {
     //UtilityFunctions::print("GDDraco::decode_draco_mesh");
+    DRACO_TRACE_ZONE("GDDraco::DecodePrimitive");
 
     //Verify if buffer ids are different
     std::set<int> buffer_ids = {position_id, normal_id, uv_id, joints_id, weights_id, indices_id};
@@ -280,6 +553,18 @@ Ref<ArrayMesh> GDDraco::decode_draco_mesh(const PackedByteArray &compressed_buff
         ERR_FAIL_COND_V_MSG(true, nullptr, "Failed to create Draco decoder");
         return nullptr;
     }
+    //Every primitive gets its own decoder, so a decoding arena would never be reused and measured no faster than the
+    //heap. Draco's buffers still go through GodotMemoryResource.
+    if (r_memory_stats) {
+        decoderSetMemoryStats(decoder, true);
+    }
+
+    //The other attributes are skipped inside the bitstream instead of being decoded and dropped
+    if (decode_positions_only()) {
+        const uint32_t position_unique_id = position_id;
+        decoderSetAttributesToDecode(decoder, &position_unique_id, 1);
+        normal_id = uv_id = joints_id = weights_id = -1;
+    }
 
     //Decode compressed buffer
     if (compressed_buffer.size() < 32) {
@@ -293,11 +578,49 @@ Ref<ArrayMesh> GDDraco::decode_draco_mesh(const PackedByteArray &compressed_buff
         return nullptr;
     }
 
+    //Smaller vertex buffers for the same geometry, the cleanup is counted as part of decoding
+    if (r_cleanup_stats) {
+        DRACO_TRACE_ZONE("GDDraco::Cleanup");
+        if (!decoderCleanup(decoder, &r_cleanup_stats->removed_vertices, &r_cleanup_stats->removed_faces)) {
+            decoderRelease(decoder);
+            ERR_FAIL_V_MSG(nullptr, "Failed to clean up Draco mesh");
+        }
+    }
+
+    if (r_memory_stats) {
+        r_memory_stats->decode = take_decoder_memory_stats(decoder);
+    }
+
+    Ref<ArrayMesh> mesh = convert_draco_mesh(decoder, position_id, normal_id, uv_id, joints_id, weights_id, r_memory_stats, r_strip_stats, r_lods);
+    decoderRelease(decoder);
+
+    return mesh;
+}
+
+bool GDDraco::decode_positions_only() {
+    return ProjectSettings::get_singleton()->get_setting("gddraco/import/positions_only", false);
+}
+
+bool GDDraco::cleanup_meshes() {
+    return ProjectSettings::get_singleton()->get_setting("gddraco/import/cleanup_meshes", false);
+}
+
+bool GDDraco::use_triangle_strips() {
+    return ProjectSettings::get_singleton()->get_setting("gddraco/import/triangle_strips", false);
+}
+
+bool GDDraco::generate_lods() {
+    return ProjectSettings::get_singleton()->get_setting("gddraco/import/generate_lods", false);
+}
+
+// Function that converts the data held by an already decoded Draco decoder into an ArrayMesh
+Ref<ArrayMesh> GDDraco::convert_draco_mesh(Decoder *decoder, int position_id, int normal_id, int uv_id, int joints_id, int weights_id, PrimitiveMemoryStats *r_memory_stats, StripStats *r_strip_stats, Dictionary *r_lods) {
+    DRACO_TRACE_ZONE("GDDraco::ConvertMesh");
     //Get vertex and index count
     uint32_t vertex_count = decoderGetVertexCount(decoder);
     uint32_t index_count = decoderGetIndexCount(decoder);
-    if (vertex_count == 0 || index_count == 0) {
-        decoderRelease(decoder);
+    const bool is_point_cloud = decoderIsPointCloud(decoder);
+    if (vertex_count == 0 || (index_count == 0 && !is_point_cloud)) {
         ERR_FAIL_COND_V_MSG(true, nullptr, "Decoded mesh has zero vertices or indices");
         return nullptr;
     }
@@ -309,30 +632,22 @@ Ref<ArrayMesh> GDDraco::decode_draco_mesh(const PackedByteArray &compressed_buff
     PackedInt32Array joints;
     PackedFloat32Array weights;
 
-    normals.resize(static_cast<int64_t>(vertex_count));
-    uvs.resize(static_cast<int64_t>(vertex_count));
-
+    //The optional arrays are only allocated once their attribute decoded, point clouds can be huge
     const int64_t joint_element_count = static_cast<int64_t>(vertex_count) * 4;
-    joints.resize(joint_element_count);
-    
     const int64_t weight_element_count = static_cast<int64_t>(vertex_count) * 4;
-    weights.resize(weight_element_count);
 
     // Decode POSITION (required) 
     if (position_id < 0) {
-        decoderRelease(decoder);
         ERR_FAIL_COND_V_MSG(true, nullptr, "No Position buffer in current mesh. Please provide a valid GLTF to decode.");
     }
     positions.resize(static_cast<int64_t>(vertex_count));
 
     if (!decoderReadAttribute(decoder, position_id, 5126, "VEC3")) {
-        decoderRelease(decoder);
         ERR_FAIL_COND_V_MSG(true, nullptr, "Failed to decode POSITION attribute");
         return nullptr;
     }
     void *test_ptr = positions.ptrw();
     if (!test_ptr) {
-        decoderRelease(decoder);
         ERR_FAIL_COND_V_MSG(true, nullptr, "positions.ptrw() is NULL");
         return nullptr;
     }
@@ -340,66 +655,63 @@ Ref<ArrayMesh> GDDraco::decode_draco_mesh(const PackedByteArray &compressed_buff
 
     // Decode NORMAL (optional)
     if (normal_id >= 0 && decoderReadAttribute(decoder, normal_id, 5126, "VEC3")) {
+        normals.resize(static_cast<int64_t>(vertex_count));
         decoderCopyAttribute(decoder, normal_id, normals.ptrw());
-    } else {
-        normals.resize(0);
     }
 
     // Decode TEXCOORD_0 (optional)
     if (uv_id >= 0 && decoderReadAttribute(decoder, uv_id, 5126, "VEC2")) {
+        uvs.resize(static_cast<int64_t>(vertex_count));
         decoderCopyAttribute(decoder, uv_id, uvs.ptrw());
-    } else {
-        uvs.resize(0);
     }
 
     // Decode JOINTS_0 (optional)
-    // Allocate temporary raw data buffer for joints (uint16_t, 2 bytes each)
+    // Temporary raw data buffer for joints (uint16_t, 2 bytes each)
     PackedByteArray raw_joint_data;
-    raw_joint_data.resize(joint_element_count * 2); // 2 bytes per uint16_t
-
     if (joints_id >= 0 && decoderReadAttribute(decoder, joints_id, 5123, "VEC4")) {
+        raw_joint_data.resize(joint_element_count * 2); // 2 bytes per uint16_t
         decoderCopyAttribute(decoder, joints_id, raw_joint_data.ptrw());
 
-        // Pointers to source (uint16_t) and destination (int32_t) arrays
+        // Widen the uint16_t joint indices to the int32_t Godot expects
+        joints.resize(joint_element_count);
         const uint16_t *src_joint = reinterpret_cast<const uint16_t *>(raw_joint_data.ptr());
-        int32_t *dst = joints.ptrw();
-
-        // Convert each uint16_t joint index to int32_t explicitly
-        for (int64_t i = 0; i < joint_element_count; i++) {
-            dst[i] = static_cast<int32_t>(src_joint[i]);
-        }
-    } else {
-        joints.resize(0);
+        draco::GetVectorKernels().widen_uint16(src_joint, static_cast<int>(joint_element_count), reinterpret_cast<uint32_t *>(joints.ptrw()));
     }
 
     // Decode WEIGHTS_0 (optional)
     if (weights_id >= 0 && decoderReadAttribute(decoder, weights_id, 5126, "VEC4")) {
+        weights.resize(weight_element_count);
         decoderCopyAttribute(decoder, weights_id, weights.ptrw());
-    } else {
-        weights.resize(0);
     }
 
-    // Decode INDICES (required)
-    if (!decoderReadIndices(decoder, 5123)) { // 5123 = unsigned short indices
-        decoderRelease(decoder);
-        ERR_FAIL_COND_V_MSG(true, nullptr, "Failed to decode indices");
-        return nullptr;
-    }
-
-    PackedByteArray raw_indices_16;
-    raw_indices_16.resize(index_count * 2);
-    decoderCopyIndices(decoder, raw_indices_16.ptrw());
-
+    // Decode INDICES (required, except for point clouds)
+    // Read as 32 bit so meshes with more than 65535 vertices keep valid indices
     PackedInt32Array indices;
-    indices.resize(index_count);
-
-    const uint16_t *src_idx = reinterpret_cast<const uint16_t *>(raw_indices_16.ptr());
-    for (uint32_t i = 0; i < index_count; ++i) {
-        indices[i] = static_cast<int32_t>(src_idx[i]);
-    }
+    Mesh::PrimitiveType primitive_type = is_point_cloud ? Mesh::PRIMITIVE_POINTS : Mesh::PRIMITIVE_TRIANGLES;
+    if (!is_point_cloud) {
+        //Strips are only kept when they need fewer indices than the triangle list
+        if (r_strip_stats) {
+            DRACO_TRACE_ZONE("GDDraco::Stripify");
+            r_strip_stats->list_indices = index_count;
+            r_strip_stats->strip_indices = 0;
+            if (decoderReadTriangleStripIndices(decoder, 5125)) {
+                const uint32_t strip_index_count = decoderGetIndicesByteLength(decoder) / sizeof(uint32_t);
+                if (strip_index_count < index_count) {
+                    r_strip_stats->strip_indices = strip_index_count;
+                    index_count = strip_index_count;
+                    primitive_type = Mesh::PRIMITIVE_TRIANGLE_STRIP;
+                }
+            }
+        }
 
+        if (primitive_type == Mesh::PRIMITIVE_TRIANGLES && !decoderReadIndices(decoder, 5125)) { // 5125 = unsigned int indices
+            ERR_FAIL_COND_V_MSG(true, nullptr, "Failed to decode indices");
+            return nullptr;
+        }
 
-    decoderRelease(decoder);
+        indices.resize(index_count);
+        decoderCopyIndices(decoder, indices.ptrw());
+    }
 
     // Now create ArrayMesh
     Ref<ArrayMesh> mesh;
@@ -414,34 +726,84 @@ Ref<ArrayMesh> GDDraco::decode_draco_mesh(const PackedByteArray &compressed_buff
         ERR_FAIL_COND_V_MSG(true, nullptr, "Invalid positions. Please provide a valid GLTF to decode.");
         return nullptr;
     }
-    if (normal_id > 0 && normals.size() == vertex_count) {
-        arrays[Mesh::ARRAY_NORMAL] = normals;
-    } else {
-        UtilityFunctions::print("Failed to set Primitive's Normals");
+    //Attributes with an id of -1 weren't requested (or are skipped by positions_only), only failures are reported
+    if (normal_id >= 0) {
+        if (normals.size() == vertex_count) {
+            arrays[Mesh::ARRAY_NORMAL] = normals;
+        } else {
+            UtilityFunctions::print("Failed to set Primitive's Normals");
+        }
     }
-    if (uv_id > 0 && uvs.size() == vertex_count) {
-        arrays[Mesh::ARRAY_TEX_UV] = uvs;
-    } else {
-        UtilityFunctions::print("Failed to set Primitive's UV");
+    if (uv_id >= 0) {
+        if (uvs.size() == vertex_count) {
+            arrays[Mesh::ARRAY_TEX_UV] = uvs;
+        } else {
+            UtilityFunctions::print("Failed to set Primitive's UV");
+        }
     }
-    if (joints_id > 0 && joints.size() == joint_element_count) {
-        arrays[Mesh::ARRAY_BONES] = joints;
-    } else {
-        UtilityFunctions::print("Failed to set Primitive's Joints/Bones");
+    if (joints_id >= 0) {
+        if (joints.size() == joint_element_count) {
+            arrays[Mesh::ARRAY_BONES] = joints;
+        } else {
+            UtilityFunctions::print("Failed to set Primitive's Joints/Bones");
+        }
     }
-    if (weights_id > 0 && weights.size() == weight_element_count) {
-        arrays[Mesh::ARRAY_WEIGHTS] = weights;
-    } else {
-        UtilityFunctions::print("Failed to set Primitive's Normals");
+    if (weights_id >= 0) {
+        if (weights.size() == weight_element_count) {
+            arrays[Mesh::ARRAY_WEIGHTS] = weights;
+        } else {
+            UtilityFunctions::print("Failed to set Primitive's Weights");
+        }
     }
-    if (indices.size() == index_count) {
-        arrays[Mesh::ARRAY_INDEX] = indices;
-    } else {
-        ERR_FAIL_COND_V_MSG(true, nullptr, "Invalid Indices. Please provide a valid GLTF to decode.");
-        return nullptr;
+    // Point clouds are drawn without indices
+    if (!is_point_cloud) {
+        if (indices.size() == index_count) {
+            arrays[Mesh::ARRAY_INDEX] = indices;
+        } else {
+            ERR_FAIL_COND_V_MSG(true, nullptr, "Invalid Indices. Please provide a valid GLTF to decode.");
+            return nullptr;
+        }
     }
 
-    mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
+    //The levels only reference the decoded vertices, strips keep the full detail since Godot's LODs are triangle lists
+    int64_t lod_index_count = 0;
+    if (r_lods && primitive_type == Mesh::PRIMITIVE_TRIANGLES) {
+        DRACO_TRACE_ZONE("GDDraco::GenerateLods");
+        const uint32_t lod_count = decoderGenerateLods(decoder, MAX_LOD_COUNT);
+        float previous_error = 0.0f;
+        for (uint32_t l = 0; l < lod_count; l++) {
+            PackedInt32Array lod_indices;
+            lod_indices.resize(decoderGetLodIndexCount(decoder, l));
+            decoderCopyLodIndices(decoder, l, reinterpret_cast<uint32_t *>(lod_indices.ptrw()));
+
+            //Godot needs increasing distances, flat meshes simplify without any error
+            const float error = MAX(decoderGetLodError(decoder, l), previous_error + CMP_EPSILON);
+            (*r_lods)[error] = lod_indices;
+            previous_error = error;
+            lod_index_count += lod_indices.size();
+        }
+    }
+
+    //The Godot arrays and the temporary joint buffer coexist with everything the decoder still holds
+    if (r_memory_stats) {
+        uint64_t decoder_live_bytes = 0;
+        r_memory_stats->read = take_decoder_memory_stats(decoder, &decoder_live_bytes);
+        r_memory_stats->convert = surface_arrays_memory(arrays);
+        if (!raw_joint_data.is_empty()) {
+            r_memory_stats->convert.allocations++;
+            r_memory_stats->convert.bytes += raw_joint_data.size();
+        }
+        if (r_lods) {
+            r_memory_stats->convert.allocations += r_lods->size();
+            r_memory_stats->convert.bytes += lod_index_count * sizeof(int32_t);
+        }
+        r_memory_stats->convert.peak_bytes = decoder_live_bytes + r_memory_stats->convert.bytes;
+    }
+
+    {
+        DRACO_TRACE_ZONE("GDDraco::BuildArrayMesh");
+        mesh->add_surface_from_arrays(primitive_type, arrays);
+    }
 
     return mesh;
 }
@@ -41,6 +41,7 @@
 #include <set>
 #include <vector>
 #include "PrimitiveData.hpp"
+#include "MemoryStats.hpp"
 
 namespace godot {
     class GDDraco: public GLTFDocumentExtension {
@@ -49,16 +50,47 @@ namespace godot {
         protected:
             static void _bind_methods();
 
-            //Custom method to connect with Draco Decoder from the Draco Wrapper
-            Ref<ArrayMesh> decode_draco_mesh(const PackedByteArray &compressed_buffer, int position_id, int normal_id, int uv_id, int joints_id, int weights_id, int indices_id);
-
             //Method that grabs the decoded mesh and adds it to an ImporterMesh
-            Ref<ImporterMesh> add_primitive_to_importer_mesh(const Ref<ArrayMesh> &source_mesh, Ref<ImporterMesh> importer_mesh);
+            Ref<ImporterMesh> add_primitive_to_importer_mesh(const Ref<ArrayMesh> &source_mesh, Ref<ImporterMesh> importer_mesh, const Dictionary &lods = Dictionary(), MemoryStageStats *r_memory_stats = nullptr);
 
         public:
+            //Each level halves the faces, so the last one keeps well under 1% of them
+            static const int MAX_LOD_COUNT = 8;
+
             GDDraco();
             ~GDDraco();
 
+            //Custom method to connect with Draco Decoder from the Draco Wrapper
+            //r_memory_stats receives the allocations of every stage when not null
+            //When r_cleanup_stats is not null the decoded mesh is cleaned up before the conversion and the removed vertices and faces are stored there
+            //When r_strip_stats is not null the mesh is emitted as triangle strips if they need fewer indices, see convert_draco_mesh
+            //When r_lods is not null it receives the levels of detail of the mesh, see convert_draco_mesh
+            static Ref<ArrayMesh> decode_draco_mesh(const PackedByteArray &compressed_buffer, int position_id, int normal_id, int uv_id, int joints_id, int weights_id, int indices_id, PrimitiveMemoryStats *r_memory_stats = nullptr, CleanupStats *r_cleanup_stats = nullptr, StripStats *r_strip_stats = nullptr, Dictionary *r_lods = nullptr);
+
+            //True when only positions and indices should be decoded (collision-only or headless imports)
+            static bool decode_positions_only();
+
+            //True when bit-identical vertices should be welded and degenerate, duplicate and unused data removed after decoding
+            static bool cleanup_meshes();
+
+            //True when meshes should be emitted as triangle strips joined by degenerate triangles
+            static bool use_triangle_strips();
+
+            //True when levels of detail should be generated right after decoding instead of by Godot's importer
+            static bool generate_lods();
+
+            //Converts an already decoded Draco mesh into an ArrayMesh (the decoder is not released)
+            //With r_strip_stats the surface is a PRIMITIVE_TRIANGLE_STRIP when the strips need fewer indices than the triangle list
+            //With r_lods the levels of detail of triangle lists are generated by quadric edge collapse, keyed by their error like ImporterMesh LODs
+            static Ref<ArrayMesh> convert_draco_mesh(Decoder *decoder, int position_id, int normal_id, int uv_id, int joints_id, int weights_id, PrimitiveMemoryStats *r_memory_stats = nullptr, StripStats *r_strip_stats = nullptr, Dictionary *r_lods = nullptr);
+
+            //Allocations of the last glTF import per stage and per primitive, empty unless memory stats are enabled
+            static Dictionary get_last_import_memory_stats();
+
+            //Records the Draco and GDDraco trace zones of every thread until stop_trace, which writes them as a Chrome trace event file
+            static Error start_trace();
+            static Error stop_trace(const String &path);
+
             //This is where our decoding logic happens
             Error _import_post_parse(const Ref<GLTFState> &p_state) override;
 
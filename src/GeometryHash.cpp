@@ -0,0 +1,272 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 itslebi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "GeometryHash.hpp"
+
+#include <godot_cpp/variant/packed_float32_array.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/packed_vector2_array.hpp>
+#include <godot_cpp/variant/packed_vector3_array.hpp>
+
+#include "draco/core/trace.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+using namespace godot;
+
+//Finalizer of splitmix64
+static uint64_t mix_u64(uint64_t p_value) {
+    p_value ^= p_value >> 30;
+    p_value *= 0xbf58476d1ce4e5b9ULL;
+    p_value ^= p_value >> 27;
+    p_value *= 0x94d049bb133111ebULL;
+    p_value ^= p_value >> 31;
+    return p_value;
+}
+
+uint64_t godot::hash_combine_u64(uint64_t p_hash, uint64_t p_value) {
+    return mix_u64(p_hash ^ (p_value + 0x9e3779b97f4a7c15ULL + (p_hash << 6) + (p_hash >> 2)));
+}
+
+static uint64_t hash_words(uint64_t p_hash, const void *p_data, size_t p_size) {
+    const uint8_t *bytes = static_cast<const uint8_t *>(p_data);
+    for (size_t i = 0; i < p_size; i += 4) {
+        uint32_t word = 0;
+        memcpy(&word, bytes + i, std::min<size_t>(4, p_size - i));
+        p_hash = hash_combine_u64(p_hash, word);
+    }
+    return p_hash;
+}
+
+//Arrays of the first surface of a mesh that are covered by the hash
+struct SurfaceGeometry {
+    Mesh::PrimitiveType primitive_type;
+    PackedVector3Array positions;
+    PackedVector3Array normals;
+    PackedVector2Array uvs;
+    PackedInt32Array bones;
+    PackedFloat32Array weights;
+    PackedInt32Array indices;
+    int64_t vertex_count;
+    bool has_normals;
+    bool has_uvs;
+    bool has_skin;
+
+    //Bytes of all attributes of one vertex
+    size_t get_vertex_size() const {
+        return sizeof(Vector3) + (has_normals ? sizeof(Vector3) : 0) + (has_uvs ? sizeof(Vector2) : 0) + (has_skin ? sizeof(int32_t) * 4 + sizeof(float) * 4 : 0);
+    }
+};
+
+//Returns false for null and empty meshes
+static bool read_surface_geometry(const Ref<ArrayMesh> &p_mesh, SurfaceGeometry *r_geometry) {
+    if (p_mesh.is_null() || p_mesh->get_surface_count() == 0) {
+        return false;
+    }
+    const Array arrays = p_mesh->surface_get_arrays(0);
+    r_geometry->primitive_type = p_mesh->surface_get_primitive_type(0);
+    r_geometry->positions = arrays[Mesh::ARRAY_VERTEX];
+    r_geometry->normals = arrays[Mesh::ARRAY_NORMAL];
+    r_geometry->uvs = arrays[Mesh::ARRAY_TEX_UV];
+    r_geometry->bones = arrays[Mesh::ARRAY_BONES];
+    r_geometry->weights = arrays[Mesh::ARRAY_WEIGHTS];
+    r_geometry->indices = arrays[Mesh::ARRAY_INDEX];
+
+    const int64_t vertex_count = r_geometry->positions.size();
+    r_geometry->vertex_count = vertex_count;
+    r_geometry->has_normals = r_geometry->normals.size() == vertex_count;
+    r_geometry->has_uvs = r_geometry->uvs.size() == vertex_count;
+    r_geometry->has_skin = r_geometry->bones.size() == vertex_count * 4 && r_geometry->weights.size() == vertex_count * 4;
+    return vertex_count > 0;
+}
+
+//Writes the attributes of vertex p_vertex to r_bytes, which holds get_vertex_size() bytes
+static void copy_vertex(const SurfaceGeometry &p_geometry, int64_t p_vertex, uint8_t *r_bytes) {
+    memcpy(r_bytes, p_geometry.positions.ptr() + p_vertex, sizeof(Vector3));
+    r_bytes += sizeof(Vector3);
+    if (p_geometry.has_normals) {
+        memcpy(r_bytes, p_geometry.normals.ptr() + p_vertex, sizeof(Vector3));
+        r_bytes += sizeof(Vector3);
+    }
+    if (p_geometry.has_uvs) {
+        memcpy(r_bytes, p_geometry.uvs.ptr() + p_vertex, sizeof(Vector2));
+        r_bytes += sizeof(Vector2);
+    }
+    if (p_geometry.has_skin) {
+        memcpy(r_bytes, p_geometry.bones.ptr() + p_vertex * 4, sizeof(int32_t) * 4);
+        r_bytes += sizeof(int32_t) * 4;
+        memcpy(r_bytes, p_geometry.weights.ptr() + p_vertex * 4, sizeof(float) * 4);
+    }
+}
+
+//Calls p_function with the vertex indices of every triangle of a triangle or strip surface. Strips are visited as
+//the triangles they describe without the degenerate ones, every other strip triangle having its winding flipped.
+//Returns false when an index is out of range
+template <typename Function>
+static bool for_each_triangle(const SurfaceGeometry &p_geometry, const Function &p_function) {
+    const bool strip = p_geometry.primitive_type == Mesh::PRIMITIVE_TRIANGLE_STRIP;
+    const bool indexed = !p_geometry.indices.is_empty();
+    const int32_t *index_data = p_geometry.indices.ptr();
+    const int64_t index_count = indexed ? p_geometry.indices.size() : p_geometry.vertex_count;
+    const int64_t triangle_count = strip ? std::max<int64_t>(index_count - 2, 0) : index_count / 3;
+    for (int64_t t = 0; t < triangle_count; t++) {
+        int64_t corner_indices[3];
+        for (int c = 0; c < 3; c++) {
+            const int64_t position = strip ? t + c : t * 3 + c;
+            corner_indices[c] = indexed ? index_data[position] : position;
+            ERR_FAIL_INDEX_V(corner_indices[c], p_geometry.vertex_count, false);
+        }
+        if (strip) {
+            if (corner_indices[0] == corner_indices[1] || corner_indices[1] == corner_indices[2] || corner_indices[0] == corner_indices[2]) {
+                continue;
+            }
+            if (t & 1) {
+                std::swap(corner_indices[0], corner_indices[1]);
+            }
+        }
+        p_function(corner_indices);
+    }
+    return true;
+}
+
+static bool is_triangle_surface(const SurfaceGeometry &p_geometry) {
+    return p_geometry.primitive_type == Mesh::PRIMITIVE_TRIANGLES || p_geometry.primitive_type == Mesh::PRIMITIVE_TRIANGLE_STRIP;
+}
+
+uint64_t godot::compute_geometry_hash(const Ref<ArrayMesh> &p_mesh) {
+    SurfaceGeometry geometry;
+    if (!read_surface_geometry(p_mesh, &geometry)) {
+        return 0;
+    }
+    DRACO_TRACE_ZONE("GDDraco::HashGeometry");
+
+    //Every vertex is hashed with all of its attributes
+    const int64_t vertex_count = geometry.vertex_count;
+    const size_t vertex_size = geometry.get_vertex_size();
+    std::vector<uint8_t> vertex(vertex_size);
+    std::vector<uint64_t> vertex_hashes(vertex_count);
+    for (int64_t v = 0; v < vertex_count; v++) {
+        copy_vertex(geometry, v, vertex.data());
+        vertex_hashes[v] = hash_words(0, vertex.data(), vertex_size);
+    }
+
+    //The hashes of the triangles are summed up, so their order doesn't matter. Each triangle starts at its smallest
+    //vertex hash, which keeps the winding order but not the first vertex. Point clouds sum up their vertices.
+    uint64_t sum = 0;
+    int64_t element_count = 0;
+    if (is_triangle_surface(geometry)) {
+        const bool valid = for_each_triangle(geometry, [&](const int64_t *p_corner_indices) {
+            uint64_t corners[3] = { vertex_hashes[p_corner_indices[0]], vertex_hashes[p_corner_indices[1]], vertex_hashes[p_corner_indices[2]] };
+            std::rotate(corners, std::min_element(corners, corners + 3), corners + 3);
+            sum += mix_u64(hash_combine_u64(hash_combine_u64(corners[0], corners[1]), corners[2]));
+            element_count++;
+        });
+        if (!valid) {
+            return 0;
+        }
+    } else {
+        element_count = vertex_count;
+        for (uint64_t hash : vertex_hashes) {
+            sum += mix_u64(hash);
+        }
+    }
+
+    uint64_t hash = hash_combine_u64(geometry.primitive_type, (geometry.has_normals ? 1 : 0) | (geometry.has_uvs ? 2 : 0) | (geometry.has_skin ? 4 : 0));
+    hash = hash_combine_u64(hash, element_count);
+    hash = hash_combine_u64(hash, sum);
+    return hash == 0 ? 1 : hash;
+}
+
+bool godot::is_same_geometry(const Ref<ArrayMesh> &p_mesh_a, const Ref<ArrayMesh> &p_mesh_b) {
+    SurfaceGeometry a;
+    SurfaceGeometry b;
+    if (!read_surface_geometry(p_mesh_a, &a) || !read_surface_geometry(p_mesh_b, &b)) {
+        return false;
+    }
+    if (a.primitive_type != b.primitive_type || a.has_normals != b.has_normals || a.has_uvs != b.has_uvs || a.has_skin != b.has_skin) {
+        return false;
+    }
+    DRACO_TRACE_ZONE("GDDraco::CompareGeometry");
+
+    //The distinct vertices of a sorted by their bytes give every vertex of both meshes a rank, so vertices are
+    //compared once and the triangles only as ranks
+    const size_t vertex_size = a.get_vertex_size();
+    std::vector<uint8_t> vertices_a(a.vertex_count * vertex_size);
+    for (int64_t v = 0; v < a.vertex_count; v++) {
+        copy_vertex(a, v, vertices_a.data() + v * vertex_size);
+    }
+    std::vector<int64_t> sorted_vertices(a.vertex_count);
+    for (int64_t v = 0; v < a.vertex_count; v++) {
+        sorted_vertices[v] = v;
+    }
+    auto vertex_less = [&](int64_t p_left, int64_t p_right) {
+        return memcmp(vertices_a.data() + p_left * vertex_size, vertices_a.data() + p_right * vertex_size, vertex_size) < 0;
+    };
+    std::sort(sorted_vertices.begin(), sorted_vertices.end(), vertex_less);
+    std::vector<int64_t> distinct_vertices;
+    std::vector<uint32_t> ranks_a(a.vertex_count);
+    for (int64_t v : sorted_vertices) {
+        if (distinct_vertices.empty() || vertex_less(distinct_vertices.back(), v)) {
+            distinct_vertices.push_back(v);
+        }
+        ranks_a[v] = static_cast<uint32_t>(distinct_vertices.size() - 1);
+    }
+
+    //Vertices of b that a doesn't have can't be part of the same geometry
+    std::vector<uint32_t> ranks_b(b.vertex_count);
+    std::vector<uint8_t> vertex(vertex_size);
+    for (int64_t v = 0; v < b.vertex_count; v++) {
+        copy_vertex(b, v, vertex.data());
+        auto found = std::lower_bound(distinct_vertices.begin(), distinct_vertices.end(), vertex, [&](int64_t p_left, const std::vector<uint8_t> &p_right) {
+            return memcmp(vertices_a.data() + p_left * vertex_size, p_right.data(), vertex_size) < 0;
+        });
+        if (found == distinct_vertices.end() || memcmp(vertices_a.data() + *found * vertex_size, vertex.data(), vertex_size) != 0) {
+            return false;
+        }
+        ranks_b[v] = static_cast<uint32_t>(found - distinct_vertices.begin());
+    }
+
+    //Same canonical order as the hash, the triangle lists or vertex lists must then be equal after sorting
+    auto collect_elements = [](const SurfaceGeometry &p_geometry, const std::vector<uint32_t> &p_ranks, std::vector<std::array<uint32_t, 3>> *r_elements) {
+        if (!is_triangle_surface(p_geometry)) {
+            for (uint32_t rank : p_ranks) {
+                r_elements->push_back({ rank, 0, 0 });
+            }
+        } else if (!for_each_triangle(p_geometry, [&](const int64_t *p_corner_indices) {
+                       std::array<uint32_t, 3> corners = { p_ranks[p_corner_indices[0]], p_ranks[p_corner_indices[1]], p_ranks[p_corner_indices[2]] };
+                       std::rotate(corners.begin(), std::min_element(corners.begin(), corners.end()), corners.end());
+                       r_elements->push_back(corners);
+                   })) {
+            return false;
+        }
+        std::sort(r_elements->begin(), r_elements->end());
+        return true;
+    };
+    std::vector<std::array<uint32_t, 3>> elements_a;
+    std::vector<std::array<uint32_t, 3>> elements_b;
+    return collect_elements(a, ranks_a, &elements_a) && collect_elements(b, ranks_b, &elements_b) && elements_a == elements_b;
+}
@@ -0,0 +1,46 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 itslebi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GEOMETRY_HASH_HPP
+#define GEOMETRY_HASH_HPP
+
+#include <godot_cpp/classes/array_mesh.hpp>
+
+#include <cstdint>
+
+namespace godot {
+    //Hash of the first surface of p_mesh that doesn't depend on the order of its vertices and triangles, so the same
+    //geometry encoded by different encoder runs (or with its attributes in another order) gets the same hash.
+    //Vertex attributes are hashed bit by bit as decoded. Returns 0 for empty meshes.
+    uint64_t compute_geometry_hash(const Ref<ArrayMesh> &p_mesh);
+
+    //Returns if the first surfaces of both meshes hold the same primitives with the same vertex attributes, ignoring
+    //the order of vertices and triangles like compute_geometry_hash. Used to confirm that equal hashes aren't a collision
+    bool is_same_geometry(const Ref<ArrayMesh> &p_mesh_a, const Ref<ArrayMesh> &p_mesh_b);
+
+    //Mixes p_value into p_hash, the order of the values matters
+    uint64_t hash_combine_u64(uint64_t p_hash, uint64_t p_value);
+}
+
+#endif //GEOMETRY_HASH_HPP
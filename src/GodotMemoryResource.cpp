@@ -0,0 +1,48 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 itslebi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "GodotMemoryResource.hpp"
+
+#include <godot_cpp/core/memory.hpp>
+
+#include <cstddef>
+
+using namespace godot;
+
+void *GodotMemoryResource::Allocate(size_t p_size, size_t p_alignment) {
+    //memalloc only guarantees the default alignment, over-aligned requests stay on the heap
+    if (p_alignment > alignof(std::max_align_t)) {
+        return draco::GetHeapMemoryResource()->Allocate(p_size, p_alignment);
+    }
+    return memalloc(p_size);
+}
+
+void GodotMemoryResource::Deallocate(void *p_ptr, size_t p_size, size_t p_alignment) {
+    if (p_alignment > alignof(std::max_align_t)) {
+        draco::GetHeapMemoryResource()->Deallocate(p_ptr, p_size, p_alignment);
+        return;
+    }
+    memfree(p_ptr);
+}
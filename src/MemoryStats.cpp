@@ -0,0 +1,117 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 itslebi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "MemoryStats.hpp"
+
+#include <godot_cpp/classes/project_settings.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/packed_vector2_array.hpp>
+#include <godot_cpp/variant/packed_vector3_array.hpp>
+
+#include <algorithm>
+
+using namespace godot;
+
+void MemoryStageStats::merge(const MemoryStageStats &p_other) {
+    allocations += p_other.allocations;
+    bytes += p_other.bytes;
+    peak_bytes = std::max(peak_bytes, p_other.peak_bytes);
+}
+
+Dictionary MemoryStageStats::to_dictionary() const {
+    Dictionary stats;
+    stats["allocations"] = static_cast<int64_t>(allocations);
+    stats["bytes"] = static_cast<int64_t>(bytes);
+    stats["peak_bytes"] = static_cast<int64_t>(peak_bytes);
+    return stats;
+}
+
+void PrimitiveMemoryStats::merge(const PrimitiveMemoryStats &p_other) {
+    load.merge(p_other.load);
+    decode.merge(p_other.decode);
+    read.merge(p_other.read);
+    convert.merge(p_other.convert);
+    importer.merge(p_other.importer);
+}
+
+Dictionary PrimitiveMemoryStats::to_dictionary() const {
+    Dictionary stats;
+    stats["load"] = load.to_dictionary();
+    stats["decode"] = decode.to_dictionary();
+    stats["read"] = read.to_dictionary();
+    stats["convert"] = convert.to_dictionary();
+    stats["importer"] = importer.to_dictionary();
+    return stats;
+}
+
+#ifdef GDDRACO_MEMORY_STATS
+bool godot::memory_stats_enabled() {
+    return ProjectSettings::get_singleton()->get_setting("gddraco/debug/memory_stats", false);
+}
+#endif
+
+MemoryStageStats godot::take_decoder_memory_stats(Decoder *p_decoder, uint64_t *r_live_bytes) {
+    MemoryStageStats stats;
+    uint64_t live_bytes = 0;
+    decoderGetMemoryStats(p_decoder, &stats.allocations, &stats.bytes, &stats.peak_bytes, &live_bytes);
+    if (r_live_bytes) {
+        *r_live_bytes = live_bytes;
+    }
+    return stats;
+}
+
+MemoryStageStats godot::surface_arrays_memory(const Array &p_arrays) {
+    MemoryStageStats stats;
+    for (int64_t i = 0; i < p_arrays.size(); i++) {
+        const Variant &array = p_arrays[i];
+        int64_t bytes = 0;
+        switch (array.get_type()) {
+            case Variant::PACKED_BYTE_ARRAY:
+                bytes = PackedByteArray(array).size();
+                break;
+            case Variant::PACKED_INT32_ARRAY:
+                bytes = PackedInt32Array(array).size() * static_cast<int64_t>(sizeof(int32_t));
+                break;
+            case Variant::PACKED_FLOAT32_ARRAY:
+                bytes = PackedFloat32Array(array).size() * static_cast<int64_t>(sizeof(float));
+                break;
+            case Variant::PACKED_VECTOR2_ARRAY:
+                bytes = PackedVector2Array(array).size() * static_cast<int64_t>(sizeof(Vector2));
+                break;
+            case Variant::PACKED_VECTOR3_ARRAY:
+                bytes = PackedVector3Array(array).size() * static_cast<int64_t>(sizeof(Vector3));
+                break;
+            default:
+                continue;
+        }
+        if (bytes > 0) {
+            stats.allocations++;
+            stats.bytes += static_cast<uint64_t>(bytes);
+        }
+    }
+    stats.peak_bytes = stats.bytes;
+    return stats;
+}
@@ -0,0 +1,75 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 itslebi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MEMORY_STATS_HPP
+#define MEMORY_STATS_HPP
+
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+
+#include <src/decoder.h>
+
+#include <cstdint>
+
+namespace godot {
+    //Allocations made during one stage of an import
+    struct MemoryStageStats {
+        uint64_t allocations = 0;
+        uint64_t bytes = 0;
+        //Most memory held at once during the stage
+        uint64_t peak_bytes = 0;
+
+        //Adds the allocations of p_other and keeps the highest peak
+        void merge(const MemoryStageStats &p_other);
+        Dictionary to_dictionary() const;
+    };
+
+    //Allocations made for one primitive, stage by stage
+    struct PrimitiveMemoryStats {
+        MemoryStageStats load;     //Copy of the compressed bufferView
+        MemoryStageStats decode;   //Draco bitstream to draco::Mesh
+        MemoryStageStats read;     //Attributes and indices converted to glTF layouts by the wrapper
+        MemoryStageStats convert;  //Godot arrays handed to the ArrayMesh
+        MemoryStageStats importer; //Surface copies made while filling the ImporterMesh
+
+        void merge(const PrimitiveMemoryStats &p_other);
+        Dictionary to_dictionary() const;
+    };
+
+#ifdef GDDRACO_MEMORY_STATS
+    //True when gddraco/debug/memory_stats is enabled
+    bool memory_stats_enabled();
+#else
+    //Builds without memory_stats=yes never count, so the accounting compiles away
+    inline bool memory_stats_enabled() { return false; }
+#endif
+
+    //Counters of p_decoder since the previous call, r_live_bytes receives what the decoder still holds
+    MemoryStageStats take_decoder_memory_stats(Decoder *p_decoder, uint64_t *r_live_bytes = nullptr);
+
+    //Packed arrays of a surface, each one counted as one allocation. Godot allocates them internally, so their sizes are the only measure
+    MemoryStageStats surface_arrays_memory(const Array &p_arrays);
+}
+
+#endif //MEMORY_STATS_HPP
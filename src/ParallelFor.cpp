@@ -0,0 +1,95 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 itslebi
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ParallelFor.hpp"
+
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#include <godot_cpp/variant/callable.hpp>
+#include <godot_cpp/variant/callable_custom.hpp>
+
+using namespace godot;
+
+//Callable that forwards the group task index to a std::function owned by parallel_for
+class ParallelForCallable : public CallableCustom {
+    const std::function<void(uint32_t)> *function;
+
+    static bool compare_equal(const CallableCustom *p_a, const CallableCustom *p_b) {
+        return p_a == p_b;
+    }
+
+    static bool compare_less(const CallableCustom *p_a, const CallableCustom *p_b) {
+        return p_a < p_b;
+    }
+
+public:
+    ParallelForCallable(const std::function<void(uint32_t)> *p_function) : function(p_function) {}
+
+    uint32_t hash() const override {
+        return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(function));
+    }
+
+    String get_as_text() const override {
+        return "GDDraco::parallel_for";
+    }
+
+    CompareEqualFunc get_compare_equal_func() const override {
+        return &ParallelForCallable::compare_equal;
+    }
+
+    CompareLessFunc get_compare_less_func() const override {
+        return &ParallelForCallable::compare_less;
+    }
+
+    //Not bound to any Object, it only lives for the duration of parallel_for
+    bool is_valid() const override {
+        return true;
+    }
+
+    ObjectID get_object() const override {
+        return ObjectID();
+    }
+
+    void call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, GDExtensionCallError &r_call_error) const override {
+        if (p_argcount != 1) {
+            r_call_error.error = GDEXTENSION_CALL_ERROR_INVALID_METHOD;
+            return;
+        }
+        (*function)(static_cast<uint32_t>(static_cast<int64_t>(*p_arguments[0])));
+        r_call_error.error = GDEXTENSION_CALL_OK;
+    }
+};
+
+void godot::parallel_for(uint32_t p_count, const std::function<void(uint32_t)> &p_function, const String &p_description) {
+    //Not worth going through the pool for a single element
+    if (p_count <= 1) {
+        for (uint32_t i = 0; i < p_count; i++) {
+            p_function(i);
+        }
+        return;
+    }
+
+    WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+    int64_t task_id = pool->add_group_task(Callable(memnew(ParallelForCallable(&p_function))), p_count, -1, false, p_description);
+    pool->wait_for_group_task_completion(task_id);
+}
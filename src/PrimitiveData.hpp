@@ -26,6 +26,21 @@
 #define PRIMITIVE_DATA_HPP
 
 #include <godot_cpp/classes/array_mesh.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+
+#include "MemoryStats.hpp"
+
+//Vertices and faces removed by the optional cleanup after decoding
+struct CleanupStats {
+    uint32_t removed_vertices = 0;
+    uint32_t removed_faces = 0;
+};
+
+//Index counts of a primitive emitted as triangle strips, strip_indices stays 0 when the triangle list was kept
+struct StripStats {
+    uint32_t list_indices = 0;
+    uint32_t strip_indices = 0;
+};
 
 //Helper class to join important related primitive data together
 class PrimitiveData {
@@ -33,6 +48,30 @@ class PrimitiveData {
         int material_Idx;
         godot::Ref<godot::ArrayMesh> primitive;
 
+        //Decoding inputs gathered from the glTF JSON (the buffer is released once decoded)
+        godot::PackedByteArray buffer;
+        int position_id = -1;
+        int normal_id = -1;
+        int uv_id = -2;
+        int joints_id = -3;
+        int weights_id = -4;
+        int indices_id = -6;
+
+        //Filled only when memory stats are enabled
+        godot::PrimitiveMemoryStats memory_stats;
+
+        //Filled only when the cleanup is enabled
+        CleanupStats cleanup_stats;
+
+        //Filled only when triangle strips are enabled
+        StripStats strip_stats;
+
+        //Levels of detail for the ImporterMesh, filled only when they are generated after decoding
+        godot::Dictionary lods;
+
+        //Filled only when meshes are deduplicated, see compute_geometry_hash
+        uint64_t geometry_hash = 0;
+
         PrimitiveData(int material_Idx, godot::Ref<godot::ArrayMesh> primitive);
 };
 
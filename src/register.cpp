@@ -24,27 +24,120 @@
 
 #include "register.hpp"
 #include "GDDraco.hpp"
+#include "DracoMesh.hpp"
+#include "DracoAnimation.hpp"
+#include "DracoLoader.hpp"
+#include "DracoSaver.hpp"
+#include "DracoExportPlugin.hpp"
+#include "GodotMemoryResource.hpp"
 
 #include <gdextension_interface.h>
 #include <godot_cpp/core/defs.hpp>
 #include <godot_cpp/godot.hpp>
+#include <godot_cpp/classes/editor_plugin_registration.hpp>
 #include <godot_cpp/classes/gltf_document.hpp>
+#include <godot_cpp/classes/project_settings.hpp>
+#include <godot_cpp/classes/resource_loader.hpp>
+#include <godot_cpp/classes/resource_saver.hpp>
 
 using namespace godot;
 
+static Ref<DracoLoader> draco_loader;
+static Ref<DracoSaver> draco_saver;
+static GodotMemoryResource godot_memory_resource;
+
+//Adds a project setting (if missing) so it shows up in the Project Settings dialog
+static void register_setting(const String &p_name, const Variant &p_default) {
+    ProjectSettings *settings = ProjectSettings::get_singleton();
+    if (!settings->has_setting(p_name)) {
+        settings->set_setting(p_name, p_default);
+    }
+    settings->set_initial_value(p_name, p_default);
+
+    Dictionary info;
+    info["name"] = p_name;
+    info["type"] = static_cast<int64_t>(p_default.get_type());
+    settings->add_property_info(info);
+}
+
 void initialize(ModuleInitializationLevel p_level) {
+    //Export plugin that compresses standalone meshes, see gddraco/export/compress_meshes
+    if (p_level == MODULE_INITIALIZATION_LEVEL_EDITOR) {
+        GDREGISTER_CLASS(DracoExportPlugin);
+        GDREGISTER_CLASS(DracoEditorPlugin);
+        EditorPlugins::add_by_type<DracoEditorPlugin>();
+        return;
+    }
     if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
         return;
     }
 
+    //Draco buffers are allocated through Godot from now on
+    draco::SetDefaultMemoryResource(&godot_memory_resource);
+
     GDREGISTER_CLASS(GDDraco);
+    GDREGISTER_CLASS(DracoMesh);
+    GDREGISTER_CLASS(DracoAnimation);
+    GDREGISTER_CLASS(DracoLoader);
+    GDREGISTER_CLASS(DracoSaver);
     GLTFDocument::register_gltf_document_extension(memnew(GDDraco));
+
+    //Collision-only or headless imports can skip everything but positions and indices
+    register_setting("gddraco/import/positions_only", false);
+
+    //Welding of bit-identical vertices and removal of degenerate and duplicate faces after decoding
+    register_setting("gddraco/import/cleanup_meshes", false);
+
+    //Triangle strips with degenerate triangles instead of triangle lists, kept only when they need fewer indices
+    register_setting("gddraco/import/triangle_strips", false);
+
+    //Levels of detail generated from the decoded connectivity, Godot's own LOD generation can then be disabled
+    register_setting("gddraco/import/generate_lods", false);
+
+    //Meshes with identical decoded geometry and materials share one ImporterMesh
+    register_setting("gddraco/import/deduplicate_meshes", false);
+
+#ifdef GDDRACO_MEMORY_STATS
+    //Allocation accounting of glTF imports, see GDDraco.get_last_import_memory_stats()
+    register_setting("gddraco/debug/memory_stats", false);
+#endif
+#ifdef DRACO_TRACE_SUPPORTED
+    //Chrome trace event file rewritten after every glTF import, see GDDraco.start_trace()
+    register_setting("gddraco/debug/trace_file", "");
+#endif
+
+    //Standalone .drc files
+    register_setting("gddraco/drc/lazy_decode", false);
+    draco_loader.instantiate();
+    ResourceLoader::get_singleton()->add_resource_format_loader(draco_loader);
+
+    //Encoder settings used when saving ArrayMeshes as .drc
+    register_setting("gddraco/encoder/compression_level", 7);
+    register_setting("gddraco/encoder/position_bits", 14);
+    register_setting("gddraco/encoder/normal_bits", 10);
+    register_setting("gddraco/encoder/uv_bits", 12);
+    register_setting("gddraco/encoder/cache_dir", "");
+    //Replaces standalone ArrayMesh resources with .dracomesh files in exported builds
+    register_setting("gddraco/export/compress_meshes", false);
+    draco_saver.instantiate();
+    ResourceSaver::get_singleton()->add_resource_format_saver(draco_saver);
 }
 
 void uninitialize(ModuleInitializationLevel p_level) {
+    if (p_level == MODULE_INITIALIZATION_LEVEL_EDITOR) {
+        EditorPlugins::remove_by_type<DracoEditorPlugin>();
+        return;
+    }
     if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
         return;
     }
+
+    ResourceLoader::get_singleton()->remove_resource_format_loader(draco_loader);
+    draco_loader.unref();
+    ResourceSaver::get_singleton()->remove_resource_format_saver(draco_saver);
+    draco_saver.unref();
+
+    draco::SetDefaultMemoryResource(nullptr);
 }
 
 extern "C" {